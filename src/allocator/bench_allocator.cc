@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "../bench/s21_bench.h"
+#include "../vector/s21_vector.h"
+#include "s21_allocator.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int kReps = 3;
+
+// Counts data-TLB load misses of this process while alive. Reports -1 when
+// perf events are unavailable (non-Linux, containers, perf_event_paranoid).
+class dtlb_counter {
+ public:
+  dtlb_counter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~dtlb_counter() {
+#ifdef __linux__
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  void start() {
+#ifdef __linux__
+    if (fd_ >= 0) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  long long stop() {
+    long long count = -1;
+#ifdef __linux__
+    if (fd_ >= 0) {
+      ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd_, &count, sizeof(count)) != sizeof(count)) count = -1;
+    }
+#endif
+    return count;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+const char *format_count(long long count, char *buffer, std::size_t size) {
+  if (count < 0) return "n/a";
+  std::snprintf(buffer, size, "%lld", count);
+  return buffer;
+}
+
+template <class Vector>
+void run(const char *name, std::size_t n) {
+  Vector v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(i * 2654435761u);
+  }
+  std::uint64_t *data = v.data();
+
+  dtlb_counter counter;
+  counter.start();
+  double scan_ns = s21::bench::measure(kReps, [data, n] {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) sum += data[i];
+    s21::bench::do_not_optimize(sum);
+  });
+  long long scan_misses = counter.stop();
+
+  // Pseudo-random gather: one element per 4KB page on average, so every
+  // load needs a fresh translation unless huge pages cover the range.
+  const std::size_t gathers = n / 8;
+  counter.start();
+  double gather_ns = s21::bench::measure(kReps, [data, n, gathers] {
+    std::uint64_t sum = 0;
+    std::uint64_t x = 88172645463325252ull;
+    for (std::size_t i = 0; i < gathers; ++i) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      sum += data[x % n];
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  long long gather_misses = counter.stop();
+
+  char buffer[32];
+  double gb = static_cast<double>(n * sizeof(std::uint64_t)) / 1e9;
+  std::printf("%-22s scan   %8.2f GB/s     dTLB misses %s\n", name,
+              gb / (scan_ns / 1e9),
+              format_count(scan_misses, buffer, sizeof(buffer)));
+  std::printf("%-22s gather %8.2f ns/load  dTLB misses %s\n", name,
+              gather_ns / static_cast<double>(gathers),
+              format_count(gather_misses, buffer, sizeof(buffer)));
+}
+
+}  // namespace
+
+// Usage: ./bench [megabytes], 256MB by default.
+int main(int argc, char **argv) {
+  std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 256;
+  std::size_t n = (megabytes << 20) / sizeof(std::uint64_t);
+  std::printf("%zu MB of uint64_t, %zu elements\n", megabytes, n);
+
+  run<s21::vector<std::uint64_t>>("std::allocator", n);
+  run<s21::vector<std::uint64_t, s21::aligned_allocator<std::uint64_t>>>(
+      "aligned_allocator<64>", n);
+  run<s21::vector<std::uint64_t, s21::huge_page_allocator<std::uint64_t>>>(
+      "huge_page_allocator", n);
+  return 0;
+}
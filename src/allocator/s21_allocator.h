@@ -0,0 +1,363 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_ALLOCATOR_H
+#define CPP2_S21_CONTAINERS_1_S21_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define S21_HAS_MMAP 1
+#endif
+
+namespace s21 {
+
+// Hands out storage aligned to Alignment bytes (a cache line by default), so
+// the first element of a vector or array can be loaded with aligned SIMD
+// instructions.
+template <class T, std::size_t Alignment = 64>
+class aligned_allocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two");
+  static_assert(Alignment >= alignof(T),
+                "Alignment must not be weaker than alignof(T)");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  template <class U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <class U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  size_type max_size() const noexcept;
+};
+
+template <class T, class U, std::size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) noexcept {
+  return true;
+}
+
+template <class T, class U, std::size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) noexcept {
+  return false;
+}
+
+template <class T, std::size_t Alignment>
+T *aligned_allocator<T, Alignment>::allocate(size_type n) {
+  if (n > max_size()) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+}
+
+template <class T, std::size_t Alignment>
+void aligned_allocator<T, Alignment>::deallocate(T *p, size_type) noexcept {
+  ::operator delete(p, std::align_val_t(Alignment));
+}
+
+template <class T, std::size_t Alignment>
+typename aligned_allocator<T, Alignment>::size_type
+aligned_allocator<T, Alignment>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+// Backs large blocks with anonymous mmap aligned to 2MB and advised with
+// MADV_HUGEPAGE, so transparent huge pages cover them and a scan over
+// hundreds of megabytes needs few TLB entries. Blocks smaller than a huge
+// page come from aligned operator new, which keeps a growing vector cheap
+// until it is big enough to benefit. Falls back to operator new where mmap
+// is unavailable.
+template <class T>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  static constexpr size_type kHugePageSize = size_type(2) << 20;
+  static constexpr size_type kSmallAlignment =
+      alignof(T) > 64 ? alignof(T) : 64;
+
+  template <class U>
+  struct rebind {
+    using other = huge_page_allocator<U>;
+  };
+
+  huge_page_allocator() noexcept = default;
+  template <class U>
+  huge_page_allocator(const huge_page_allocator<U> &) noexcept {}
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  size_type max_size() const noexcept;
+
+  // True when a block of n elements is served by mmap rather than new.
+  static bool is_mapped(size_type n) noexcept;
+
+ private:
+  static size_type mapped_length(size_type n) noexcept;
+};
+
+template <class T, class U>
+bool operator==(const huge_page_allocator<T> &,
+                const huge_page_allocator<U> &) noexcept {
+  return true;
+}
+
+template <class T, class U>
+bool operator!=(const huge_page_allocator<T> &,
+                const huge_page_allocator<U> &) noexcept {
+  return false;
+}
+
+template <class T>
+bool huge_page_allocator<T>::is_mapped(size_type n) noexcept {
+#ifdef S21_HAS_MMAP
+  return n * sizeof(T) >= kHugePageSize;
+#else
+  (void)n;
+  return false;
+#endif
+}
+
+template <class T>
+typename huge_page_allocator<T>::size_type
+huge_page_allocator<T>::mapped_length(size_type n) noexcept {
+  return (n * sizeof(T) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+}
+
+template <class T>
+T *huge_page_allocator<T>::allocate(size_type n) {
+  if (n > max_size()) {
+    throw std::bad_array_new_length();
+  }
+  if (!is_mapped(n)) {
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(kSmallAlignment)));
+  }
+#ifdef S21_HAS_MMAP
+  // Over-map by one huge page and trim, so the block starts on a 2MB
+  // boundary and the kernel can back it with whole huge pages.
+  size_type length = mapped_length(n);
+  void *raw = mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  char *base = static_cast<char *>(raw);
+  std::size_t address = reinterpret_cast<std::size_t>(base);
+  char *aligned = base + ((kHugePageSize - address % kHugePageSize) %
+                          kHugePageSize);
+  if (aligned != base) {
+    munmap(base, aligned - base);
+  }
+  char *tail = aligned + length;
+  char *mapping_end = base + length + kHugePageSize;
+  if (tail != mapping_end) {
+    munmap(tail, mapping_end - tail);
+  }
+#ifdef MADV_HUGEPAGE
+  madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+  return reinterpret_cast<T *>(aligned);
+#else
+  return nullptr;
+#endif
+}
+
+template <class T>
+void huge_page_allocator<T>::deallocate(T *p, size_type n) noexcept {
+  if (!is_mapped(n)) {
+    ::operator delete(p, std::align_val_t(kSmallAlignment));
+    return;
+  }
+#ifdef S21_HAS_MMAP
+  munmap(p, mapped_length(n));
+#endif
+}
+
+template <class T>
+typename huge_page_allocator<T>::size_type huge_page_allocator<T>::max_size()
+    const noexcept {
+  return (std::numeric_limits<size_type>::max() - 2 * kHugePageSize) /
+         sizeof(T);
+}
+
+// Hands out small blocks carved from 64KB slabs and keeps freed ones on a
+// free list per 16-byte size class, so a node container that allocates and
+// frees in a steady state stops calling operator new once the pool has
+// grown to its working set. Slabs go back to the system only when the pool
+// is destroyed. Not thread-safe.
+class node_pool {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kGranule = 16;
+  static constexpr size_type kClasses = 16;
+  static constexpr size_type kMaxBytes = kGranule * kClasses;
+  static constexpr size_type kSlabBytes = size_type(64) << 10;
+
+  node_pool() = default;
+  node_pool(const node_pool &) = delete;
+  node_pool &operator=(const node_pool &) = delete;
+  ~node_pool();
+
+  // bytes must be at most kMaxBytes; blocks are kGranule-aligned.
+  void *allocate(size_type bytes);
+  void deallocate(void *p, size_type bytes) noexcept;
+  // Slabs taken from operator new so far.
+  size_type slabs() const noexcept { return slab_count_; }
+
+ private:
+  struct free_block {
+    free_block *next;
+  };
+  struct slab {
+    slab *next;
+  };
+
+  free_block *free_[kClasses] = {};
+  slab *slabs_ = nullptr;
+  char *cursor_ = nullptr;
+  char *limit_ = nullptr;
+  size_type slab_count_ = 0;
+
+  static size_type class_of(size_type bytes) noexcept {
+    return (bytes + kGranule - 1) / kGranule - 1;
+  }
+};
+
+inline node_pool::~node_pool() {
+  while (slabs_) {
+    slab *next = slabs_->next;
+    ::operator delete(slabs_);
+    slabs_ = next;
+  }
+}
+
+inline void *node_pool::allocate(size_type bytes) {
+  size_type size_class = class_of(bytes);
+  if (free_block *block = free_[size_class]) {
+    free_[size_class] = block->next;
+    return block;
+  }
+  size_type size = (size_class + 1) * kGranule;
+  if (static_cast<size_type>(limit_ - cursor_) < size) {
+    // The tail of the old slab (under kMaxBytes) is abandoned.
+    char *raw = static_cast<char *>(::operator new(kSlabBytes));
+    slabs_ = new (raw) slab{slabs_};
+    cursor_ = raw + kGranule;
+    limit_ = raw + kSlabBytes;
+    ++slab_count_;
+  }
+  void *p = cursor_;
+  cursor_ += size;
+  return p;
+}
+
+inline void node_pool::deallocate(void *p, size_type bytes) noexcept {
+  size_type size_class = class_of(bytes);
+  free_[size_class] = new (p) free_block{free_[size_class]};
+}
+
+// Allocator over a shared node_pool. Single-object allocations of up to
+// node_pool::kMaxBytes come from the pool; anything else (arrays, large or
+// over-aligned types) goes to operator new at alignof(T). A default-constructed
+// allocator makes a new pool; copies and rebound copies share it, so a
+// container and the nodes it rebinds to use one pool, and several
+// containers can share one by being built from the same allocator. Pools
+// are freed with the last allocator using them.
+template <class T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = pool_allocator<U>;
+  };
+
+  pool_allocator() : pool_(std::make_shared<node_pool>()) {}
+  explicit pool_allocator(std::shared_ptr<node_pool> pool) noexcept
+      : pool_(std::move(pool)) {}
+  // No move operations: a move copies the pool handle, so a moved-from
+  // allocator (and the container holding it) can still allocate.
+  pool_allocator(const pool_allocator &) noexcept = default;
+  pool_allocator &operator=(const pool_allocator &) noexcept = default;
+  template <class U>
+  pool_allocator(const pool_allocator<U> &other) noexcept
+      : pool_(other.pool()) {}
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  size_type max_size() const noexcept;
+
+  const std::shared_ptr<node_pool> &pool() const noexcept { return pool_; }
+
+ private:
+  static constexpr bool kPooled = sizeof(T) <= node_pool::kMaxBytes &&
+                                  alignof(T) <= node_pool::kGranule;
+
+  std::shared_ptr<node_pool> pool_;
+};
+
+template <class T, class U>
+bool operator==(const pool_allocator<T> &a,
+                const pool_allocator<U> &b) noexcept {
+  return a.pool() == b.pool();
+}
+
+template <class T, class U>
+bool operator!=(const pool_allocator<T> &a,
+                const pool_allocator<U> &b) noexcept {
+  return a.pool() != b.pool();
+}
+
+template <class T>
+T *pool_allocator<T>::allocate(size_type n) {
+  if (kPooled && n == 1) {
+    return static_cast<T *>(pool_->allocate(sizeof(T)));
+  }
+  if (n > max_size()) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+template <class T>
+void pool_allocator<T>::deallocate(T *p, size_type n) noexcept {
+  if (kPooled && n == 1) {
+    pool_->deallocate(p, sizeof(T));
+  } else {
+    ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+  }
+}
+
+template <class T>
+typename pool_allocator<T>::size_type pool_allocator<T>::max_size()
+    const noexcept {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_ALLOCATOR_H
@@ -0,0 +1,167 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "gtest/gtest.h"
+#include "s21_allocator.h"
+
+namespace {
+
+bool is_aligned(const void *p, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(aligned_allocator_suite, vector_storage_is_aligned) {
+  s21::vector<float, s21::aligned_allocator<float, 64>> v;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(static_cast<float>(i));
+    EXPECT_TRUE(is_aligned(v.data(), 64));
+  }
+  EXPECT_EQ(v[999], 999.0f);
+}
+
+TEST(aligned_allocator_suite, wide_alignment) {
+  s21::vector<double, s21::aligned_allocator<double, 4096>> v(10);
+  EXPECT_TRUE(is_aligned(v.data(), 4096));
+  v.shrink_to_fit();
+  EXPECT_EQ(v.size(), static_cast<size_t>(10));
+}
+
+TEST(aligned_allocator_suite, copy_and_move_keep_alignment) {
+  s21::vector<std::string, s21::aligned_allocator<std::string>> a = {
+      "one", "two", "three"};
+  s21::vector<std::string, s21::aligned_allocator<std::string>> b(a);
+  s21::vector<std::string, s21::aligned_allocator<std::string>> c(
+      std::move(a));
+
+  EXPECT_TRUE(is_aligned(b.data(), 64));
+  EXPECT_TRUE(is_aligned(c.data(), 64));
+  EXPECT_EQ(b[2], "three");
+  EXPECT_EQ(c[0], "one");
+}
+
+TEST(aligned_allocator_suite, array_storage_is_aligned) {
+  s21::array<int, 16, s21::aligned_allocator<int, 64>> arr = {1, 2, 3};
+  EXPECT_TRUE(is_aligned(arr.data(), 64));
+  EXPECT_EQ(arr[2], 3);
+  EXPECT_EQ(arr[15], 0);
+}
+
+TEST(huge_page_allocator_suite, small_blocks_use_heap) {
+  s21::vector<int, s21::huge_page_allocator<int>> v = {1, 2, 3};
+  EXPECT_FALSE(s21::huge_page_allocator<int>::is_mapped(v.capacity()));
+  EXPECT_TRUE(is_aligned(v.data(), 64));
+  EXPECT_EQ(v[1], 2);
+}
+
+TEST(huge_page_allocator_suite, large_blocks_are_huge_page_aligned) {
+  const std::size_t n = (std::size_t(8) << 20) / sizeof(std::uint64_t);
+  s21::vector<std::uint64_t, s21::huge_page_allocator<std::uint64_t>> v;
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(i);
+  }
+  ASSERT_TRUE(s21::huge_page_allocator<std::uint64_t>::is_mapped(v.capacity()));
+  EXPECT_TRUE(is_aligned(
+      v.data(), s21::huge_page_allocator<std::uint64_t>::kHugePageSize));
+
+  std::uint64_t sum = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    sum += v[i];
+  }
+  EXPECT_EQ(sum, n * (n - 1) / 2);
+}
+
+TEST(huge_page_allocator_suite, array_storage) {
+  s21::array<char, (std::size_t(4) << 20),
+             s21::huge_page_allocator<char>>
+      arr;
+  arr.fill('x');
+  EXPECT_EQ(arr.back(), 'x');
+  EXPECT_TRUE(
+      is_aligned(arr.data(), s21::huge_page_allocator<char>::kHugePageSize));
+}
+
+TEST(pool_allocator_suite, freed_blocks_are_reused) {
+  s21::pool_allocator<std::uint64_t> alloc;
+  std::uint64_t *a = alloc.allocate(1);
+  std::uint64_t *b = alloc.allocate(1);
+  EXPECT_NE(a, b);
+  EXPECT_TRUE(is_aligned(a, s21::node_pool::kGranule));
+  alloc.deallocate(a, 1);
+  EXPECT_EQ(alloc.allocate(1), a);
+  for (int i = 0; i < 10000; ++i) alloc.deallocate(alloc.allocate(1), 1);
+  EXPECT_EQ(alloc.pool()->slabs(), static_cast<size_t>(1));
+  alloc.deallocate(a, 1);
+  alloc.deallocate(b, 1);
+}
+
+TEST(pool_allocator_suite, copies_and_rebinds_share_the_pool) {
+  s21::pool_allocator<int> a;
+  s21::pool_allocator<int> b;
+  s21::pool_allocator<int> c(a);
+  s21::pool_allocator<std::string> d(a);
+  EXPECT_TRUE(a == c);
+  EXPECT_TRUE(a == d);
+  EXPECT_TRUE(a != b);
+
+  // Blocks of the same size class are interchangeable between rebinds.
+  std::string *s = d.allocate(1);
+  d.deallocate(s, 1);
+  s21::pool_allocator<char[sizeof(std::string)]> e(a);
+  EXPECT_EQ(static_cast<void *>(e.allocate(1)), static_cast<void *>(s));
+}
+
+TEST(pool_allocator_suite, moved_from_container_keeps_its_pool) {
+  s21::pool_allocator<int> a;
+  s21::pool_allocator<int> b(std::move(a));
+  EXPECT_TRUE(a == b);
+
+  s21::vector<int, s21::pool_allocator<int>> v;
+  v.push_back(1);
+  s21::vector<int, s21::pool_allocator<int>> w(std::move(v));
+  v.push_back(2);
+  w.push_back(3);
+  EXPECT_EQ(v.size(), static_cast<size_t>(1));
+  EXPECT_EQ(v[0], 2);
+  EXPECT_EQ(w[1], 3);
+  EXPECT_TRUE(v.get_allocator() == w.get_allocator());
+}
+
+TEST(pool_allocator_suite, arrays_and_large_types_bypass_the_pool) {
+  struct big {
+    char bytes[s21::node_pool::kMaxBytes + 1];
+  };
+  s21::pool_allocator<big> alloc;
+  big *one = alloc.allocate(1);
+  s21::vector<int, s21::pool_allocator<int>> v(100);
+  v.push_back(1);
+  EXPECT_EQ(alloc.pool()->slabs(), static_cast<size_t>(0));
+  EXPECT_EQ(v.get_allocator().pool()->slabs(), static_cast<size_t>(0));
+  alloc.deallocate(one, 1);
+}
+
+TEST(pool_allocator_suite, over_aligned_types_keep_their_alignment) {
+  struct alignas(64) line {
+    char bytes[64];
+  };
+  s21::pool_allocator<line> alloc;
+  line *one = alloc.allocate(1);
+  line *many = alloc.allocate(5);
+  EXPECT_TRUE(is_aligned(one, 64));
+  EXPECT_TRUE(is_aligned(many, 64));
+  alloc.deallocate(one, 1);
+  alloc.deallocate(many, 5);
+  s21::vector<line, s21::pool_allocator<line>> v(3);
+  v.push_back(line());
+  EXPECT_TRUE(is_aligned(v.data(), 64));
+  EXPECT_EQ(alloc.pool()->slabs(), static_cast<size_t>(0));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -3,16 +3,20 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 
 #include "iostream"
 
 namespace s21 {
-template <class T, std::size_t N>
+// Elements live in storage obtained from Allocator, so an array can be
+// placed on aligned or huge-page memory like s21::vector.
+template <class T, std::size_t N, class Allocator = std::allocator<T>>
 class array {
  public:
   // Member type
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -50,48 +54,76 @@ class array {
  private:
   iterator array_;
   size_t capacity_ = N;
+  Allocator alloc_{};
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  void release();
 };
 
 ////////////////////////////////// Constructor ///////////////////////////////
-template <class T, std::size_t N>
-array<T, N>::array() {
-  array_ = new T[N]();
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator>::array() {
+  array_ = alloc_traits::allocate(alloc_, N);
+  try {
+    std::uninitialized_value_construct_n(array_, N);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, array_, N);
+    throw;
+  }
 }
 
-template <class T, std::size_t N>
-array<T, N>::array(const std::initializer_list<value_type> &items) {
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator>::array(
+    const std::initializer_list<value_type> &items)
+    : array() {
   if (items.size() > capacity_) {
     throw std::length_error("Initializer is too large");
   }
-  array_ = new T[N]();
   std::copy(items.begin(), items.end(), array_);
 }
 
-template <class T, std::size_t N>
-array<T, N>::array(const array &a) : capacity_(N) {
-  array_ = new T[N];
-  std::copy(a.array_, a.array_ + N, array_);
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator>::array(const array &a)
+    : capacity_(N),
+      alloc_(alloc_traits::select_on_container_copy_construction(a.alloc_)) {
+  array_ = alloc_traits::allocate(alloc_, N);
+  try {
+    std::uninitialized_copy(a.array_, a.array_ + N, array_);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, array_, N);
+    throw;
+  }
 }
 
-template <class T, std::size_t N>
-array<T, N>::array(array &&a) noexcept
-    : array_(a.array_), capacity_(a.capacity_) {
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator>::array(array &&a) noexcept
+    : array_(a.array_), capacity_(a.capacity_), alloc_(std::move(a.alloc_)) {
   a.array_ = nullptr;
   a.capacity_ = 0;
 }
 
-template <class T, std::size_t N>
-array<T, N>::~array() {
-  delete[] array_;
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator>::~array() {
+  release();
+}
+
+template <class T, std::size_t N, class Allocator>
+void array<T, N, Allocator>::release() {
+  if (array_) {
+    std::destroy(array_, array_ + N);
+    alloc_traits::deallocate(alloc_, array_, N);
+  }
 }
 
 //////////////////////////// Operator Constructor ///////////////////////////
-template <class T, std::size_t N>
-array<T, N> &array<T, N>::operator=(array &&a) {
+template <class T, std::size_t N, class Allocator>
+array<T, N, Allocator> &array<T, N, Allocator>::operator=(array &&a) {
   if (this != &a) {
-    delete[] array_;
+    release();
     array_ = a.array_;
     capacity_ = a.capacity_;
+    alloc_ = std::move(a.alloc_);
     a.array_ = nullptr;
     a.capacity_ = 0;
   }
@@ -99,72 +131,76 @@ array<T, N> &array<T, N>::operator=(array &&a) {
 }
 
 ////////////////////////////////// Capacity //////////////////////////////////
-template <class T, std::size_t N>
-bool array<T, N>::empty() const {
+template <class T, std::size_t N, class Allocator>
+bool array<T, N, Allocator>::empty() const {
   return !capacity_;
 }
 
-template <class T, std::size_t N>
-typename array<T, N>::size_type array<T, N>::size() const {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::size_type
+array<T, N, Allocator>::size() const {
   return capacity_;
 }
 
-template <class T, std::size_t N>
-typename array<T, N>::size_type array<T, N>::max_size() const {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::size_type
+array<T, N, Allocator>::max_size() const {
   return capacity_;
 }
 
 ////////////////////////////////// Iterator //////////////////////////////////
-template <class T, std::size_t N>
-typename array<T, N>::iterator array<T, N>::begin() const {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::iterator
+array<T, N, Allocator>::begin() const {
   return array_;
 }
 
-template <class T, std::size_t N>
-typename array<T, N>::iterator array<T, N>::end() const {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::iterator array<T, N, Allocator>::end() const {
   return array_ + capacity_;
 }
 
 ////////////////////////////////// Modifiers //////////////////////////////////
-template <class T, std::size_t N>
-void array<T, N>::swap(array &other) {
+template <class T, std::size_t N, class Allocator>
+void array<T, N, Allocator>::swap(array &other) {
   std::swap(capacity_, other.capacity_);
   std::swap(array_, other.array_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template <class T, std::size_t N>
-void array<T, N>::fill(const_reference value) {
-  for (size_type i = 0; i < capacity_; i++) {
-    array_[i] = value;
-  }
+template <class T, std::size_t N, class Allocator>
+void array<T, N, Allocator>::fill(const_reference value) {
+  std::fill_n(array_, capacity_, value);
 }
 
 //////////////////////////////// Element Access //////////////////////////////
-template <class T, std::size_t N>
-T &array<T, N>::at(array::size_type pos) {
+template <class T, std::size_t N, class Allocator>
+T &array<T, N, Allocator>::at(array::size_type pos) {
   if (pos >= capacity_) {
     throw std::out_of_range("out of range");
   }
   return array_[pos];
 }
 
-template <class T, std::size_t N>
-T &array<T, N>::operator[](array::size_type pos) {
+template <class T, std::size_t N, class Allocator>
+T &array<T, N, Allocator>::operator[](array::size_type pos) {
   return array_[pos];
 }
 
-template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::front() {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::const_reference
+array<T, N, Allocator>::front() {
   return array_[0];
 }
 
-template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::back() {
+template <class T, std::size_t N, class Allocator>
+typename array<T, N, Allocator>::const_reference
+array<T, N, Allocator>::back() {
   return array_[capacity_ - 1];
 }
 
-template <class T, std::size_t N>
-T *array<T, N>::data() {
+template <class T, std::size_t N, class Allocator>
+T *array<T, N, Allocator>::data() {
   return array_;
 }
 }  // namespace s21
@@ -0,0 +1,81 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BENCH_H
+#define CPP2_S21_CONTAINERS_1_S21_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace s21 {
+namespace bench {
+
+// Keeps the optimizer from discarding a value that is only computed to be
+// timed.
+template <class T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs fn() reps times and returns the fastest run in nanoseconds.
+template <class Fn>
+double measure(int reps, Fn &&fn) {
+  double best = 0;
+  for (int i = 0; i < reps; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    if (i == 0 || ns < best) {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+// Prints one result line; n is the container size and ops the number of
+// operations the time is spread over.
+inline void report(const char *name, std::size_t n, std::size_t ops,
+                   double ns) {
+  std::printf("%-44s n=%-10zu %10.3f ms %9.2f ns/op\n", name, n, ns / 1e6,
+              ops ? ns / static_cast<double>(ops) : 0.0);
+}
+
+inline void report(const char *name, std::size_t ops, double ns) {
+  report(name, ops, ops, ns);
+}
+
+#ifdef S21_BENCH_COUNT_ALLOCATIONS
+// Every operator new in the process, counted and summed, so a bench can
+// report what a workload allocates. Define S21_BENCH_COUNT_ALLOCATIONS
+// before including this header in the bench's only translation unit.
+inline std::size_t allocations = 0;
+inline std::size_t allocated_bytes = 0;
+#endif
+
+}  // namespace bench
+}  // namespace s21
+
+#ifdef S21_BENCH_COUNT_ALLOCATIONS
+void *operator new(std::size_t size) {
+  ++s21::bench::allocations;
+  s21::bench::allocated_bytes += size;
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+// GCC inlines these into std::allocator and then flags the malloc/free pair
+// as a new/delete mismatch; they are the replacements, so it is not one.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BENCH_H
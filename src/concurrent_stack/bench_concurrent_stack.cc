@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+#include "../bench/s21_bench.h"
+#include "../stack/s21_stack.h"
+#include "../vector/s21_vector.h"
+#include "s21_concurrent_stack.h"
+
+namespace {
+
+const int kReps = 3;
+const std::size_t kBatch = 64;
+
+// The baseline: s21::stack behind one mutex.
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<int> stack_;
+};
+
+template <class Fn>
+double run_threads(std::size_t threads, Fn fn) {
+  return s21::bench::measure(kReps, [threads, &fn] {
+    s21::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.push_back(std::thread(fn));
+    }
+    for (std::thread &w : workers) w.join();
+  });
+}
+
+void report(const char *name, std::size_t threads, std::size_t ops,
+            double ns) {
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s threads=%zu", name, threads);
+  s21::bench::report(label, ops, ns);
+}
+
+// Free-list traffic: every thread takes a node and gives one back.
+template <class Stack>
+void push_pop(const char *name, std::size_t threads, std::size_t per_thread) {
+  Stack s;
+  for (int i = 0; i < 1024; ++i) s.push(i);
+  double ns = run_threads(threads, [&s, per_thread] {
+    int value = 0;
+    for (std::size_t i = 0; i < per_thread; ++i) {
+      if (s.pop(value)) s.push(value);
+    }
+  });
+  report(name, threads, 2 * threads * per_thread, ns);
+}
+
+// Batched: each thread pushes kBatch values with one push_many, then drains
+// whatever is on the stack with one pop_all.
+void batches(std::size_t threads, std::size_t per_thread) {
+  s21::concurrent_stack<int> s;
+  double ns = run_threads(threads, [&s, per_thread] {
+    int in[kBatch] = {};
+    s21::vector<int> out;
+    for (std::size_t i = 0; i < per_thread; i += kBatch) {
+      s.push_many(in, in + kBatch);
+      out.clear();
+      s.pop_all(std::back_inserter(out));
+    }
+  });
+  report("s21::concurrent_stack batched", threads,
+         2 * threads * per_thread, ns);
+}
+
+}  // namespace
+
+// Usage: ./bench [max_threads]
+int main(int argc, char **argv) {
+  std::size_t max_threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+  std::size_t total = std::size_t(1) << 21;
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    push_pop<locked_stack>("mutex + s21::stack", threads, total / threads);
+    push_pop<s21::concurrent_stack<int>>("s21::concurrent_stack", threads,
+                                         total / threads);
+    batches(threads, total / threads);
+  }
+  return 0;
+}
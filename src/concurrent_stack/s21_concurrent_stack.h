@@ -0,0 +1,285 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_CONCURRENT_STACK_H
+#define CPP2_S21_CONTAINERS_1_S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Lock-free LIFO for any number of threads (a Treiber stack). The top is one
+// 64-bit word holding a 32-bit node index and a 32-bit tag that every
+// successful CAS bumps, so a node that is popped and pushed back between
+// another thread's read and CAS (the ABA problem) makes that CAS fail.
+//
+// Nodes are never returned to the system while the stack lives: popped
+// nodes go to an internal free list (a second tagged Treiber stack) and are
+// reused. A thread that read a node just before it was popped therefore
+// reads a stale but valid node, never freed memory. Nodes live in chunks
+// that double in size and never move, found from the index with a shift.
+template <class T>
+class concurrent_stack {
+ public:
+  //  Member type
+  using value_type = T;
+  using size_type = size_t;
+
+  //  Member functions
+  concurrent_stack() = default;
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack();
+
+  //  Capacity
+  // A snapshot; other threads may change it before it is returned.
+  bool empty() const;
+
+  //  Modifiers
+  void push(const T &value);
+  void push(T &&value);
+  template <typename... Args>
+  void emplace(Args &&...args);
+  // Takes the top element. Returns false if the stack was empty.
+  bool pop(T &value);
+  // Pushes [first, last) with a single CAS on the top, in order, so *first
+  // ends up deepest. Other threads see all of them or none.
+  template <class InputIt>
+  void push_many(InputIt first, InputIt last);
+  // Detaches the whole stack with a single CAS and moves it to out, top
+  // first. Returns how many elements there were.
+  template <class OutputIt>
+  size_type pop_all(OutputIt out);
+
+ private:
+  using index_type = std::uint32_t;
+  using word = std::uint64_t;
+
+  struct node {
+    std::atomic<index_type> next;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+
+  // Index 0 is the empty link; node i lives at position i - 1.
+  static constexpr index_type kNull = 0;
+  static constexpr size_type kFirstChunk = 64;
+  static constexpr size_type kChunks = 32;
+
+  static index_type index_of(word w) { return static_cast<index_type>(w); }
+  static word make_word(index_type index, word old) {
+    return ((old >> 32) + 1) << 32 | index;
+  }
+
+  node &at(index_type index) const;
+  index_type acquire_node();
+  // Links a chain from top down to bottom, already joined through next, on
+  // head.
+  static void push_chain(std::atomic<word> &head, index_type top,
+                         node &bottom);
+  index_type pop_one(std::atomic<word> &head) const;
+
+  std::atomic<word> top_{0};
+  std::atomic<word> free_{0};
+  std::atomic<size_type> fresh_{0};
+  // Chunk k holds kFirstChunk << k nodes, starting at kFirstChunk * (2^k - 1).
+  std::atomic<node *> chunks_[kChunks] = {};
+};
+
+// CONSTRUCTOR
+
+template <class T>
+concurrent_stack<T>::~concurrent_stack() {
+  for (index_type i = index_of(top_.load(std::memory_order_acquire));
+       i != kNull; i = at(i).next.load(std::memory_order_relaxed)) {
+    at(i).value()->~T();
+  }
+  for (std::atomic<node *> &chunk : chunks_) {
+    delete[] chunk.load(std::memory_order_relaxed);
+  }
+}
+
+// Capacity
+
+template <class T>
+bool concurrent_stack<T>::empty() const {
+  return index_of(top_.load(std::memory_order_acquire)) == kNull;
+}
+
+// Modifiers
+
+template <class T>
+void concurrent_stack<T>::push(const T &value) {
+  emplace(value);
+}
+
+template <class T>
+void concurrent_stack<T>::push(T &&value) {
+  emplace(std::move(value));
+}
+
+template <class T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args &&...args) {
+  index_type i = acquire_node();
+  node &n = at(i);
+  try {
+    ::new (static_cast<void *>(n.storage)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    push_chain(free_, i, n);
+    throw;
+  }
+  push_chain(top_, i, n);
+}
+
+template <class T>
+bool concurrent_stack<T>::pop(T &value) {
+  index_type i = pop_one(top_);
+  if (i == kNull) return false;
+  node &n = at(i);
+  try {
+    value = std::move(*n.value());
+  } catch (...) {
+    push_chain(top_, i, n);
+    throw;
+  }
+  n.value()->~T();
+  push_chain(free_, i, n);
+  return true;
+}
+
+template <class T>
+template <class InputIt>
+void concurrent_stack<T>::push_many(InputIt first, InputIt last) {
+  index_type top = kNull, bottom = kNull;
+  try {
+    for (; first != last; ++first) {
+      index_type i = acquire_node();
+      node &n = at(i);
+      try {
+        ::new (static_cast<void *>(n.storage)) T(*first);
+      } catch (...) {
+        push_chain(free_, i, n);
+        throw;
+      }
+      n.next.store(top, std::memory_order_relaxed);
+      top = i;
+      if (bottom == kNull) bottom = i;
+    }
+  } catch (...) {
+    for (index_type i = top; i != kNull;
+         i = at(i).next.load(std::memory_order_relaxed)) {
+      at(i).value()->~T();
+    }
+    if (top != kNull) push_chain(free_, top, at(bottom));
+    throw;
+  }
+  if (top != kNull) push_chain(top_, top, at(bottom));
+}
+
+template <class T>
+template <class OutputIt>
+typename concurrent_stack<T>::size_type concurrent_stack<T>::pop_all(
+    OutputIt out) {
+  word old = top_.load(std::memory_order_relaxed);
+  while (index_of(old) != kNull &&
+         !top_.compare_exchange_weak(old, make_word(kNull, old),
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+  }
+  index_type chain = index_of(old);
+  size_type count = 0;
+  index_type i = chain, last = kNull;
+  try {
+    for (; i != kNull; ++out, ++count) {
+      node &n = at(i);
+      *out = std::move(*n.value());
+      n.value()->~T();
+      last = i;
+      i = n.next.load(std::memory_order_relaxed);
+    }
+  } catch (...) {
+    // The element that failed and everything under it go back on the stack.
+    index_type bottom = i;
+    while (at(bottom).next.load(std::memory_order_relaxed) != kNull) {
+      bottom = at(bottom).next.load(std::memory_order_relaxed);
+    }
+    if (last != kNull) push_chain(free_, chain, at(last));
+    push_chain(top_, i, at(bottom));
+    throw;
+  }
+  if (last != kNull) push_chain(free_, chain, at(last));
+  return count;
+}
+
+// Nodes
+
+template <class T>
+typename concurrent_stack<T>::node &concurrent_stack<T>::at(
+    index_type index) const {
+  size_type pos = index - 1;
+  size_type k = 63 - __builtin_clzll(pos / kFirstChunk + 1);
+  node *chunk = chunks_[k].load(std::memory_order_acquire);
+  return chunk[pos - kFirstChunk * ((size_type{1} << k) - 1)];
+}
+
+// Reuses a free node, or takes the next never-used index and makes sure its
+// chunk exists. Racing threads may both allocate a chunk; the loser of the
+// install CAS frees its copy.
+template <class T>
+typename concurrent_stack<T>::index_type concurrent_stack<T>::acquire_node() {
+  index_type i = pop_one(free_);
+  if (i != kNull) return i;
+  size_type pos = fresh_.fetch_add(1, std::memory_order_relaxed);
+  if (pos >= std::numeric_limits<index_type>::max()) {
+    fresh_.fetch_sub(1, std::memory_order_relaxed);
+    throw std::length_error("concurrent_stack is out of node indices");
+  }
+  size_type k = 63 - __builtin_clzll(pos / kFirstChunk + 1);
+  if (chunks_[k].load(std::memory_order_acquire) == nullptr) {
+    node *fresh = new node[kFirstChunk << k];
+    node *expected = nullptr;
+    if (!chunks_[k].compare_exchange_strong(expected, fresh,
+                                            std::memory_order_acq_rel)) {
+      delete[] fresh;
+    }
+  }
+  return static_cast<index_type>(pos + 1);
+}
+
+template <class T>
+void concurrent_stack<T>::push_chain(std::atomic<word> &head,
+                                     index_type top, node &bottom) {
+  word old = head.load(std::memory_order_relaxed);
+  do {
+    bottom.next.store(index_of(old), std::memory_order_relaxed);
+  } while (!head.compare_exchange_weak(old, make_word(top, old),
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+// Reading next from a node another thread has just popped is harmless: the
+// node still exists, and the tag makes the CAS fail.
+template <class T>
+typename concurrent_stack<T>::index_type concurrent_stack<T>::pop_one(
+    std::atomic<word> &head) const {
+  word old = head.load(std::memory_order_acquire);
+  for (;;) {
+    index_type i = index_of(old);
+    if (i == kNull) return kNull;
+    index_type next = at(i).next.load(std::memory_order_relaxed);
+    if (head.compare_exchange_weak(old, make_word(next, old),
+                                   std::memory_order_acquire,
+                                   std::memory_order_acquire)) {
+      return i;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_CONCURRENT_STACK_H
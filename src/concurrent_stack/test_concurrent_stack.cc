@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test/s21_test.h"
+#include "gtest/gtest.h"
+#include "s21_concurrent_stack.h"
+
+using s21::test::fragile;
+
+TEST(concurrent_stack_suite, push_and_pop_are_lifo) {
+  s21::concurrent_stack<std::string> s;
+  EXPECT_TRUE(s.empty());
+  s.push("a");
+  std::string b = "b";
+  s.push(b);
+  s.emplace(2, 'c');
+  std::string value;
+  ASSERT_TRUE(s.pop(value));
+  EXPECT_EQ(value, "cc");
+  ASSERT_TRUE(s.pop(value));
+  EXPECT_EQ(value, "b");
+  ASSERT_TRUE(s.pop(value));
+  EXPECT_EQ(value, "a");
+  EXPECT_FALSE(s.pop(value));
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(concurrent_stack_suite, push_many_and_pop_all) {
+  s21::concurrent_stack<int> s;
+  s.push(0);
+  std::vector<int> in = {1, 2, 3, 4};
+  s.push_many(in.begin(), in.end());
+  s.push_many(in.begin(), in.begin());
+  std::vector<int> out;
+  EXPECT_EQ(s.pop_all(std::back_inserter(out)), static_cast<size_t>(5));
+  EXPECT_EQ(out, (std::vector<int>{4, 3, 2, 1, 0}));
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.pop_all(std::back_inserter(out)), static_cast<size_t>(0));
+}
+
+TEST(concurrent_stack_suite, reuses_nodes_across_chunks) {
+  s21::concurrent_stack<int> s;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) s.push(i);
+    int value = -1;
+    for (int i = 999; i >= 0; --i) {
+      ASSERT_TRUE(s.pop(value));
+      ASSERT_EQ(value, i);
+    }
+  }
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(concurrent_stack_suite, move_only_elements) {
+  s21::concurrent_stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(1));
+  s.emplace(new int(2));
+  std::unique_ptr<int> p;
+  ASSERT_TRUE(s.pop(p));
+  EXPECT_EQ(*p, 2);
+}
+
+TEST(concurrent_stack_suite, failed_push_many_changes_nothing) {
+  {
+    s21::concurrent_stack<fragile> s;
+    s.emplace(7);
+    std::vector<fragile> in(3);
+    fragile::copies_left = 0;
+    EXPECT_THROW(s.push_many(in.begin(), in.end()), std::runtime_error);
+    fragile::copies_left = -1;
+    EXPECT_EQ(fragile::live, 4);
+    fragile out;
+    ASSERT_TRUE(s.pop(out));
+    EXPECT_EQ(out.value, 7);
+    EXPECT_TRUE(s.empty());
+    s.emplace(8);
+    s.emplace(9);
+  }
+  EXPECT_EQ(fragile::live, 0);
+}
+
+TEST(concurrent_stack_suite, threads_pop_each_element_once) {
+  const int threads = 4, per_thread = 20000;
+  s21::concurrent_stack<int> s;
+  std::vector<std::atomic<int>> seen(threads * per_thread);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&s, &seen, t] {
+      int value;
+      for (int i = 0; i < per_thread; ++i) {
+        s.push(t * per_thread + i);
+        if (i % 2 && s.pop(value)) seen[value].fetch_add(1);
+      }
+    });
+  }
+  for (std::thread &w : workers) w.join();
+  int value;
+  while (s.pop(value)) seen[value].fetch_add(1);
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(),
+                          [](const std::atomic<int> &c) { return c == 1; }));
+}
+
+TEST(concurrent_stack_suite, pop_all_races_with_push_many) {
+  const int rounds = 2000;
+  s21::concurrent_stack<int> s;
+  std::atomic<bool> done{false};
+  std::atomic<long long> drained{0};
+  std::thread drainer([&] {
+    std::vector<int> out;
+    while (!done.load() || !s.empty()) {
+      out.clear();
+      s.pop_all(std::back_inserter(out));
+      // Batches arrive whole: 1, 2, 3 in this order from the top.
+      for (std::size_t i = 0; i < out.size(); i += 3) {
+        if (out[i] != 3 || out[i + 1] != 2 || out[i + 2] != 1) return;
+        drained += 6;
+      }
+    }
+  });
+  int batch[] = {1, 2, 3};
+  for (int r = 0; r < rounds; ++r) s.push_many(batch, batch + 3);
+  done = true;
+  drainer.join();
+  EXPECT_EQ(drained.load(), 6LL * rounds);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <deque>
+
+#include "../bench/s21_bench.h"
+#include "s21_deque.h"
+
+namespace {
+
+const int kReps = 5;
+
+// Sliding window: push at the back, drop from the front once full.
+template <class Deque>
+void window(const char *name, std::size_t width, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [width, n] {
+    Deque d;
+    long long sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      d.push_back(static_cast<int>(i));
+      if (d.size() > width) {
+        sum += d.front();
+        d.pop_front();
+      }
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, width, n, ns);
+}
+
+template <class Deque>
+void scan(const char *name, Deque &d) {
+  double ns = s21::bench::measure(kReps, [&d] {
+    long long sum = 0;
+    for (std::size_t i = 0; i < d.size(); ++i) sum += d[i];
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, d.size(), ns);
+}
+
+}  // namespace
+
+int main() {
+  std::size_t n = std::size_t(1) << 22;
+  for (std::size_t width : {std::size_t(64), std::size_t(1) << 18}) {
+    window<std::deque<int>>("std::deque<int> sliding window", width, n);
+    window<s21::deque<int>>("s21::deque<int> sliding window", width, n);
+  }
+  std::deque<int> sd;
+  s21::deque<int> d;
+  for (std::size_t i = 0; i < n; ++i) {
+    sd.push_front(static_cast<int>(i));
+    d.push_front(static_cast<int>(i));
+  }
+  scan("std::deque<int> indexed scan", sd);
+  scan("s21::deque<int> indexed scan", d);
+  return 0;
+}
@@ -0,0 +1,581 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_DEQUE_H
+#define CPP2_S21_CONTAINERS_1_S21_DEQUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Double-ended queue kept in one circular buffer whose capacity is a power
+// of two, so a logical index maps to a slot with an add and a mask. Pushes
+// and pops at either end are O(1) and allocate only when the buffer doubles;
+// elements stay in two contiguous runs at most. Growth relocates every
+// element and invalidates all iterators and references, as in s21::vector.
+// As in s21::list, front() and back() of an empty deque return a default T
+// and the pops do nothing.
+template <class T, class Allocator = std::allocator<T>>
+class deque {
+  template <bool Const>
+  class basic_iterator;
+
+ public:
+  //  Member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using size_type = size_t;
+
+  //  Member functions
+  deque();
+  explicit deque(const Allocator &alloc);
+  deque(size_type n, const Allocator &alloc = Allocator());
+  deque(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator());
+  deque(const deque &d);
+  deque(deque &&d) noexcept;
+  ~deque();
+
+  deque &operator=(const deque &d);
+  deque &operator=(deque &&d) noexcept;
+
+  //  Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  allocator_type get_allocator() const;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  void resize(size_type count);
+
+  //  Modifiers
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  T *buffer_ = nullptr;
+  size_type capacity_{};
+  size_type head_{};
+  size_type size_{};
+  Allocator alloc_{};
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  T *slot(size_type pos) const;
+  size_type next_capacity(size_type min_capacity) const;
+  void relocate_to(T *dest);
+  void reallocate(size_type new_capacity);
+  template <typename... Args>
+  void realloc_emplace(bool front, Args &&...args);
+};
+
+// Random-access iterator holding the buffer, its mask and the head, so
+// dereferencing does not go back through the deque.
+template <class T, class Allocator>
+template <bool Const>
+class deque<T, Allocator>::basic_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  basic_iterator() = default;
+  basic_iterator(T *buffer, size_type mask, size_type head, size_type index)
+      : buffer_(buffer), mask_(mask), head_(head), index_(index) {}
+  template <bool C = Const, class = std::enable_if_t<C>>
+  basic_iterator(const basic_iterator<false> &it)
+      : buffer_(it.buffer_), mask_(it.mask_), head_(it.head_),
+        index_(it.index_) {}
+
+  reference operator*() const { return buffer_[(head_ + index_) & mask_]; }
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  basic_iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+  basic_iterator operator++(int) {
+    basic_iterator old = *this;
+    ++index_;
+    return old;
+  }
+  basic_iterator &operator--() {
+    --index_;
+    return *this;
+  }
+  basic_iterator operator--(int) {
+    basic_iterator old = *this;
+    --index_;
+    return old;
+  }
+  basic_iterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  basic_iterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+  friend basic_iterator operator+(basic_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend basic_iterator operator+(difference_type n, basic_iterator it) {
+    return it += n;
+  }
+  friend basic_iterator operator-(basic_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const basic_iterator &a,
+                                   const basic_iterator &b) {
+    return static_cast<difference_type>(a.index_) -
+           static_cast<difference_type>(b.index_);
+  }
+
+  friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ == b.index_;
+  }
+  friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ != b.index_;
+  }
+  friend bool operator<(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ < b.index_;
+  }
+  friend bool operator>(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ > b.index_;
+  }
+  friend bool operator<=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ <= b.index_;
+  }
+  friend bool operator>=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ >= b.index_;
+  }
+
+ private:
+  friend class basic_iterator<true>;
+
+  T *buffer_{};
+  size_type mask_{};
+  size_type head_{};
+  size_type index_{};
+};
+
+// CONSTRUCTOR
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque() = default;
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(const Allocator &alloc) : alloc_(alloc) {}
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(size_type n, const Allocator &alloc)
+    : deque(alloc) {
+  resize(n);
+}
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(const std::initializer_list<value_type> &items,
+                           const Allocator &alloc)
+    : deque(alloc) {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(const deque &d)
+    : deque(alloc_traits::select_on_container_copy_construction(d.alloc_)) {
+  reserve(d.size_);
+  for (size_type i = 0; i < d.size_; ++i) push_back(d[i]);
+}
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(deque &&d) noexcept
+    : buffer_(std::exchange(d.buffer_, nullptr)),
+      capacity_(std::exchange(d.capacity_, 0)),
+      head_(std::exchange(d.head_, 0)),
+      size_(std::exchange(d.size_, 0)),
+      alloc_(std::move(d.alloc_)) {}
+
+template <class T, class Allocator>
+deque<T, Allocator>::~deque() {
+  clear();
+  if (buffer_) alloc_traits::deallocate(alloc_, buffer_, capacity_);
+}
+
+template <class T, class Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(const deque &d) {
+  if (this != &d) {
+    deque copy(d);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class T, class Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(deque &&d) noexcept {
+  if (this != &d) {
+    deque old(std::move(*this));
+    swap(d);
+  }
+  return *this;
+}
+
+// Element access
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::operator[](
+    size_type pos) {
+  return *slot(pos);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::operator[](
+    size_type pos) const {
+  return *slot(pos);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::front()
+    const {
+  static const T default_value = T{};
+  if (size_ == 0) {
+    return default_value;
+  }
+  return *slot(0);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::back()
+    const {
+  static const T default_value = T{};
+  if (size_ == 0) {
+    return default_value;
+  }
+  return *slot(size_ - 1);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::allocator_type
+deque<T, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+// Iterators
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::begin() {
+  return iterator(buffer_, capacity_ - 1, head_, 0);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::iterator deque<T, Allocator>::end() {
+  return iterator(buffer_, capacity_ - 1, head_, size_);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::begin()
+    const {
+  return const_iterator(buffer_, capacity_ - 1, head_, 0);
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::const_iterator deque<T, Allocator>::end()
+    const {
+  return const_iterator(buffer_, capacity_ - 1, head_, size_);
+}
+
+// Capacity
+
+template <class T, class Allocator>
+bool deque<T, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const {
+  return size_;
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::max_size() const {
+  // The capacity must stay a power of two.
+  size_type n = std::numeric_limits<size_type>::max() / sizeof(value_type);
+  while (n & (n - 1)) n &= n - 1;
+  return n;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::reserve(size_type size) {
+  if (size > capacity_) {
+    reallocate(next_capacity(size));
+  }
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::shrink_to_fit() {
+  if (size_ == 0) {
+    if (buffer_) alloc_traits::deallocate(alloc_, buffer_, capacity_);
+    buffer_ = nullptr;
+    capacity_ = head_ = 0;
+    return;
+  }
+  size_type fit = 1;
+  while (fit < size_) fit *= 2;
+  if (fit != capacity_) reallocate(fit);
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::resize(size_type count) {
+  while (size_ > count) pop_back();
+  reserve(count);
+  while (size_ < count) emplace_back();
+}
+
+// Modifiers
+
+template <class T, class Allocator>
+void deque<T, Allocator>::clear() {
+  while (size_ != 0) pop_back();
+  head_ = 0;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class T, class Allocator>
+template <typename... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_back(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    realloc_emplace(false, std::forward<Args>(args)...);
+  } else {
+    alloc_traits::construct(alloc_, slot(size_), std::forward<Args>(args)...);
+    ++size_;
+  }
+  return *slot(size_ - 1);
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <class T, class Allocator>
+template <typename... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_front(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    realloc_emplace(true, std::forward<Args>(args)...);
+  } else {
+    size_type head = (head_ - 1) & (capacity_ - 1);
+    alloc_traits::construct(alloc_, buffer_ + head,
+                            std::forward<Args>(args)...);
+    head_ = head;
+    ++size_;
+  }
+  return *slot(0);
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::pop_back() {
+  if (size_ == 0) {
+    return;
+  }
+  --size_;
+  alloc_traits::destroy(alloc_, slot(size_));
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::pop_front() {
+  if (size_ == 0) {
+    return;
+  }
+  alloc_traits::destroy(alloc_, buffer_ + head_);
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::swap(deque &other) noexcept {
+  std::swap(buffer_, other.buffer_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
+}
+
+template <class T, class Allocator>
+template <typename... Args>
+void deque<T, Allocator>::insert_many_back(Args &&...args) {
+  if constexpr (sizeof...(args) != 0) {
+    // Materialized first, so args may refer into the storage reserve() frees.
+    T temp[] = {T(std::forward<Args>(args))...};
+    reserve(size_ + sizeof...(args));
+    for (T &item : temp) emplace_back(std::move(item));
+  }
+}
+
+// Pushes each argument to the front in turn, as s21::list does, so the last
+// argument ends up first.
+template <class T, class Allocator>
+template <typename... Args>
+void deque<T, Allocator>::insert_many_front(Args &&...args) {
+  if constexpr (sizeof...(args) != 0) {
+    T temp[] = {T(std::forward<Args>(args))...};
+    reserve(size_ + sizeof...(args));
+    for (T &item : temp) emplace_front(std::move(item));
+  }
+}
+
+// Storage
+
+template <class T, class Allocator>
+T *deque<T, Allocator>::slot(size_type pos) const {
+  return buffer_ + ((head_ + pos) & (capacity_ - 1));
+}
+
+template <class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::next_capacity(
+    size_type min_capacity) const {
+  if (min_capacity > max_size()) {
+    throw std::length_error("length_error");
+  }
+  size_type new_capacity = capacity_ ? capacity_ : 1;
+  while (new_capacity < min_capacity) new_capacity *= 2;
+  return new_capacity;
+}
+
+// Builds the elements, front first, at dest[0, size_). The ring is at most
+// two runs; if the second one fails, the first is torn down again so the
+// deque is left as it was.
+template <class T, class Allocator>
+void deque<T, Allocator>::relocate_to(T *dest) {
+  size_type first_run = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+  uninitialized_relocate(buffer_ + head_, buffer_ + head_ + first_run, dest);
+  try {
+    uninitialized_relocate(buffer_, buffer_ + (size_ - first_run),
+                           dest + first_run);
+  } catch (...) {
+    std::destroy(dest, dest + first_run);
+    throw;
+  }
+  destroy_relocated(buffer_ + head_, buffer_ + head_ + first_run);
+  destroy_relocated(buffer_, buffer_ + (size_ - first_run));
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::reallocate(size_type new_capacity) {
+  T *new_buffer = alloc_traits::allocate(alloc_, new_capacity);
+  try {
+    relocate_to(new_buffer);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, new_buffer, new_capacity);
+    throw;
+  }
+  if (buffer_) alloc_traits::deallocate(alloc_, buffer_, capacity_);
+  buffer_ = new_buffer;
+  capacity_ = new_capacity;
+  head_ = 0;
+}
+
+// Full buffer: the new element is built in the doubled buffer before the old
+// ones move, so args may still refer into the current storage. A new front
+// element goes in the last slot and becomes the head.
+template <class T, class Allocator>
+template <typename... Args>
+void deque<T, Allocator>::realloc_emplace(bool front, Args &&...args) {
+  size_type new_capacity = next_capacity(size_ + 1);
+  T *new_buffer = alloc_traits::allocate(alloc_, new_capacity);
+  T *place = new_buffer + (front ? new_capacity - 1 : size_);
+  try {
+    alloc_traits::construct(alloc_, place, std::forward<Args>(args)...);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, new_buffer, new_capacity);
+    throw;
+  }
+  try {
+    relocate_to(new_buffer);
+  } catch (...) {
+    alloc_traits::destroy(alloc_, place);
+    alloc_traits::deallocate(alloc_, new_buffer, new_capacity);
+    throw;
+  }
+  if (buffer_) alloc_traits::deallocate(alloc_, buffer_, capacity_);
+  buffer_ = new_buffer;
+  capacity_ = new_capacity;
+  head_ = front ? new_capacity - 1 : 0;
+  ++size_;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_DEQUE_H
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "../test/s21_test.h"
+#include "gtest/gtest.h"
+#include "s21_deque.h"
+
+using s21::test::fragile;
+
+TEST(deque_suite, push_pop_both_ends) {
+  s21::deque<int> d;
+  std::deque<int> expected;
+  EXPECT_TRUE(d.empty());
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3 == 0) {
+      d.push_front(i);
+      expected.push_front(i);
+    } else {
+      d.push_back(i);
+      expected.push_back(i);
+    }
+  }
+  d.pop_front();
+  expected.pop_front();
+  d.pop_back();
+  expected.pop_back();
+  ASSERT_EQ(d.size(), expected.size());
+  EXPECT_EQ(d.front(), expected.front());
+  EXPECT_EQ(d.back(), expected.back());
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin()));
+}
+
+TEST(deque_suite, wraps_without_growing) {
+  s21::deque<int> d;
+  d.reserve(8);
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(8));
+  for (int i = 0; i < 1000; ++i) {
+    d.push_back(i);
+    if (d.size() > 5) d.pop_front();
+  }
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(8));
+  EXPECT_EQ(d.size(), static_cast<size_t>(5));
+  for (size_t i = 0; i < d.size(); ++i) {
+    EXPECT_EQ(d[i], static_cast<int>(995 + i));
+  }
+  EXPECT_THROW(d.at(5), std::out_of_range);
+}
+
+TEST(deque_suite, growth_keeps_order_when_wrapped) {
+  s21::deque<std::string> d;
+  for (int i = 0; i < 4; ++i) d.push_back(std::to_string(i));
+  d.pop_front();
+  d.pop_front();
+  for (int i = 4; i < 6; ++i) d.push_back(std::to_string(i));
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(4));
+  d.push_front("1");
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(8));
+  d.push_back("6");
+  d.push_front("0");
+  EXPECT_EQ(d.size(), static_cast<size_t>(7));
+  for (size_t i = 0; i < d.size(); ++i) EXPECT_EQ(d[i], std::to_string(i));
+}
+
+TEST(deque_suite, emplace_from_own_element) {
+  s21::deque<std::string> d = {"first"};
+  for (int i = 0; i < 20; ++i) {
+    d.emplace_back(d.front());
+    d.push_front(d.back());
+  }
+  EXPECT_EQ(d.size(), static_cast<size_t>(41));
+  EXPECT_TRUE(std::all_of(d.begin(), d.end(),
+                          [](const std::string &s) { return s == "first"; }));
+}
+
+TEST(deque_suite, insert_many_and_random_access) {
+  s21::deque<int> d = {4, 5};
+  d.insert_many_back(6, 7, 8);
+  d.insert_many_front(3, 2, 1);
+  s21::deque<int>::iterator it = d.begin();
+  EXPECT_EQ(d.end() - it, 8);
+  EXPECT_EQ(it[3], 4);
+  EXPECT_EQ(*(it + 7), 8);
+  std::reverse(d.begin(), d.end());
+  std::sort(d.begin(), d.end());
+  const s21::deque<int> &cd = d;
+  EXPECT_EQ(std::accumulate(cd.begin(), cd.end(), 0), 36);
+  EXPECT_TRUE(std::is_sorted(cd.begin(), cd.end()));
+}
+
+TEST(deque_suite, copy_move_swap) {
+  s21::deque<std::string> a = {"x", "y"};
+  a.push_front("w");
+  s21::deque<std::string> b(a);
+  b[0] = "changed";
+  EXPECT_EQ(a[0], "w");
+  s21::deque<std::string> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(c[0], "changed");
+  a.swap(c);
+  EXPECT_EQ(a[0], "changed");
+  EXPECT_EQ(c[0], "w");
+  b = c;
+  c = std::move(a);
+  EXPECT_EQ(b.back(), "y");
+  EXPECT_EQ(c.front(), "changed");
+}
+
+TEST(deque_suite, resize_shrink_clear) {
+  s21::deque<int> d(3);
+  EXPECT_EQ(d[2], 0);
+  for (int i = 0; i < 30; ++i) d.push_front(i);
+  d.resize(5);
+  EXPECT_EQ(d.back(), 25);
+  d.shrink_to_fit();
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(8));
+  EXPECT_EQ(d.front(), 29);
+  d.clear();
+  EXPECT_TRUE(d.empty());
+  d.shrink_to_fit();
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(0));
+  d.push_back(1);
+  EXPECT_EQ(d.front(), 1);
+}
+
+TEST(deque_suite, empty_pops_and_access) {
+  s21::deque<int> d;
+  d.pop_back();
+  d.pop_front();
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(d.front(), 0);
+  EXPECT_EQ(d.back(), 0);
+  d.push_back(1);
+  d.pop_front();
+  d.pop_front();
+  d.pop_back();
+  EXPECT_EQ(d.size(), static_cast<size_t>(0));
+  d.push_front(2);
+  d.push_back(3);
+  EXPECT_EQ(d.front(), 2);
+  EXPECT_EQ(d.back(), 3);
+}
+
+TEST(deque_suite, failed_growth_leaves_deque_intact) {
+  s21::deque<fragile> d;
+  for (int i = 0; i < 4; ++i) d.push_back(fragile(i));
+  d.pop_front();
+  d.push_back(fragile(4));
+  fragile::copies_left = 2;
+  EXPECT_THROW(d.push_back(fragile(5)), std::runtime_error);
+  fragile::copies_left = -1;
+  ASSERT_EQ(d.size(), static_cast<size_t>(4));
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(4));
+  for (size_t i = 0; i < d.size(); ++i) {
+    EXPECT_EQ(d[i].value, static_cast<int>(i + 1));
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
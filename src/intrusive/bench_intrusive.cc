@@ -0,0 +1,143 @@
+#define S21_BENCH_COUNT_ALLOCATIONS
+
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../bench/s21_bench.h"
+#include "../list/s21_list.h"
+#include "../set/s21_set.h"
+#include "s21_intrusive.h"
+
+namespace {
+
+const int kReps = 5;
+
+// An order book entry indexed two ways: by age, for expiry, and by price,
+// for matching. A reprice moves it to the back of the age order and to its
+// new place in the price order.
+struct order {
+  int id = 0;
+  int price = 0;
+  s21::list_hook by_age;
+  s21::set_hook by_price;
+};
+
+struct price_then_id {
+  bool operator()(const order &a, const order &b) const {
+    return a.price < b.price || (a.price == b.price && a.id < b.id);
+  }
+};
+
+// The same two indexes as containers of values: the list holds ids, the
+// set holds (price, id) keys, and each order keeps its list iterator so it
+// can be found again without a scan.
+struct plain_order {
+  int id = 0;
+  int price = 0;
+  s21::list<int>::iterator age;
+};
+
+struct intrusive_book {
+  explicit intrusive_book(std::size_t n) : orders(n) {
+    for (std::size_t i = 0; i < n; ++i) orders[i].id = static_cast<int>(i);
+  }
+
+  void add(std::size_t i, int price) {
+    order &o = orders[i];
+    o.price = price;
+    ages.push_back(o);
+    prices.insert(o);
+  }
+
+  void reprice(std::size_t i, int price) {
+    order &o = orders[i];
+    ages.unlink(o);
+    prices.unlink(o);
+    o.price = price;
+    ages.push_back(o);
+    prices.insert(o);
+  }
+
+  int best() const { return prices.begin()->price; }
+
+  std::vector<order> orders;
+  s21::intrusive_list<order, &order::by_age> ages;
+  s21::intrusive_set<order, &order::by_price, price_then_id> prices;
+};
+
+struct plain_book {
+  explicit plain_book(std::size_t n) : orders(n) {
+    for (std::size_t i = 0; i < n; ++i) orders[i].id = static_cast<int>(i);
+  }
+
+  void add(std::size_t i, int price) {
+    plain_order &o = orders[i];
+    o.price = price;
+    ages.push_back(o.id);
+    o.age = --ages.end();
+    prices.insert(std::make_pair(o.price, o.id));
+  }
+
+  void reprice(std::size_t i, int price) {
+    plain_order &o = orders[i];
+    ages.erase(o.age);
+    prices.erase(prices.find(std::make_pair(o.price, o.id)));
+    o.price = price;
+    ages.push_back(o.id);
+    o.age = --ages.end();
+    prices.insert(std::make_pair(o.price, o.id));
+  }
+
+  int best() const { return (*prices.begin()).first; }
+
+  std::vector<plain_order> orders;
+  s21::list<int> ages;
+  s21::set<std::pair<int, int>> prices;
+};
+
+// Builds a book of n orders, then reprices random orders n times. Reports
+// the time per operation of each phase and the allocations per reprice.
+template <class Book>
+void build_and_reprice(const char *build, const char *reprice, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    Book book(n);
+    std::mt19937 rng(1);
+    for (std::size_t i = 0; i < n; ++i) {
+      book.add(i, static_cast<int>(rng() % 100000));
+    }
+    s21::bench::do_not_optimize(book.best());
+  });
+  s21::bench::report(build, n, ns);
+
+  Book book(n);
+  std::mt19937 rng(1);
+  for (std::size_t i = 0; i < n; ++i) {
+    book.add(i, static_cast<int>(rng() % 100000));
+  }
+  std::size_t before = s21::bench::allocations;
+  ns = s21::bench::measure(kReps, [&book, &rng, n] {
+    for (std::size_t i = 0; i < n; ++i) {
+      book.reprice(rng() % n, static_cast<int>(rng() % 100000));
+    }
+    s21::bench::do_not_optimize(book.best());
+  });
+  std::size_t made = s21::bench::allocations - before;
+  s21::bench::report(reprice, n, n, ns);
+  std::printf("      allocations per reprice: %.3f\n",
+              static_cast<double>(made) / (n * kReps));
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 18}) {
+    build_and_reprice<plain_book>("s21::list + s21::set build",
+                                  "s21::list + s21::set reprice", n);
+    build_and_reprice<intrusive_book>("intrusive_list + intrusive_set build",
+                                      "intrusive_list + intrusive_set reprice",
+                                      n);
+  }
+  return 0;
+}
@@ -0,0 +1,906 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_INTRUSIVE_H
+#define CPP2_S21_CONTAINERS_1_S21_INTRUSIVE_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../tree/tree.h"
+
+namespace s21 {
+
+// Links embedded in a user type so the object itself is the container node.
+// A type holds one hook per container it can be in at once, and names the
+// hook when it instantiates the container:
+//
+//   struct order {
+//     std::uint64_t price;
+//     s21::list_hook by_age;
+//     s21::set_hook by_price;
+//   };
+//   s21::intrusive_list<order, &order::by_age> queue;
+//   s21::intrusive_set<order, &order::by_price, by_price_less> book;
+//
+// The containers never allocate, copy or destroy elements; they only link
+// and unlink them. An object must stay where it is while linked and must be
+// unlinked before it is destroyed. Copying an object copies its other
+// members but leaves the copy's hooks unlinked.
+struct list_hook {
+  list_hook() = default;
+  list_hook(const list_hook &) noexcept {}
+  list_hook &operator=(const list_hook &) noexcept { return *this; }
+
+  bool is_linked() const { return next != nullptr; }
+
+  list_hook *next = nullptr;
+  list_hook *prev = nullptr;
+};
+
+struct set_hook {
+  set_hook() = default;
+  set_hook(const set_hook &) noexcept {}
+  set_hook &operator=(const set_hook &) noexcept { return *this; }
+
+  bool is_linked() const { return height != 0; }
+
+  set_hook *left = nullptr;
+  set_hook *right = nullptr;
+  set_hook *parent = nullptr;
+  // 0 while unlinked, the AVL height of the subtree while linked.
+  int height = 0;
+};
+
+namespace internal {
+
+// Maps between an object and its Member hook, the way the kernel's
+// container_of does: the member's offset is measured once on raw storage
+// and subtracted from a hook's address to find the object around it.
+template <class T, class Hook, Hook T::*Member>
+struct member_hook {
+  static std::ptrdiff_t offset() {
+    alignas(T) static unsigned char probe[sizeof(T)];
+    const T *object = reinterpret_cast<const T *>(probe);
+    return reinterpret_cast<const unsigned char *>(&(object->*Member)) - probe;
+  }
+  static Hook *hook(T &value) { return &(value.*Member); }
+  static T *owner(Hook *h) {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(h) -
+                                 offset());
+  }
+};
+
+}  // namespace internal
+
+// A doubly linked list threaded through each element's Hook. Insertion,
+// erase and unlink are O(1) and never allocate; splice and merge relink
+// elements between lists.
+template <class T, list_hook T::*Hook>
+class intrusive_list {
+  template <bool Const>
+  class basic_iterator;
+
+ public:
+  //  Member type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using size_type = size_t;
+
+  //  Member functions
+  intrusive_list();
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&l) noexcept;
+  // Unlinks every element; the elements themselves are untouched.
+  ~intrusive_list();
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&l) noexcept;
+
+  //  Element access
+  reference front();
+  reference back();
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  // The position of value, which must be linked into this list.
+  iterator iterator_to(reference value);
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  //  Modifiers
+  void clear();
+  iterator insert(const_iterator pos, reference value);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  // Removes value, which must be linked into this list, in O(1).
+  void unlink(reference value);
+  void push_back(reference value);
+  void pop_back();
+  void push_front(reference value);
+  void pop_front();
+  void swap(intrusive_list &other) noexcept;
+  void merge(intrusive_list &other);
+  template <class Compare>
+  void merge(intrusive_list &other, Compare comp);
+  void splice(const_iterator pos, intrusive_list &other);
+  void splice(const_iterator pos, intrusive_list &other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator first, const_iterator last);
+  void reverse();
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+
+ private:
+  using hooks = internal::member_hook<T, list_hook, Hook>;
+
+  list_hook sentinel_;
+  size_type size_ = 0;
+
+  static void link_chain(list_hook *pos, list_hook *first, list_hook *last);
+  static void unlink_chain(list_hook *first, list_hook *last);
+};
+
+template <class T, list_hook T::*Hook>
+template <bool Const>
+class intrusive_list<T, Hook>::basic_iterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  basic_iterator() = default;
+  template <bool C = Const, class = std::enable_if_t<C>>
+  basic_iterator(const basic_iterator<false> &it) : hook_(it.hook_) {}
+
+  reference operator*() const { return *hooks::owner(hook_); }
+  pointer operator->() const { return hooks::owner(hook_); }
+
+  basic_iterator &operator++() {
+    hook_ = hook_->next;
+    return *this;
+  }
+  basic_iterator operator++(int) {
+    basic_iterator old = *this;
+    hook_ = hook_->next;
+    return old;
+  }
+  basic_iterator &operator--() {
+    hook_ = hook_->prev;
+    return *this;
+  }
+  basic_iterator operator--(int) {
+    basic_iterator old = *this;
+    hook_ = hook_->prev;
+    return old;
+  }
+
+  friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+    return a.hook_ == b.hook_;
+  }
+  friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+    return a.hook_ != b.hook_;
+  }
+
+ private:
+  friend class intrusive_list;
+  friend class basic_iterator<true>;
+
+  explicit basic_iterator(list_hook *hook) : hook_(hook) {}
+
+  list_hook *hook_{};
+};
+
+// A set of T ordered by Compare, threaded through each element's Hook and
+// kept balanced with the AVL rotations BinaryTree uses. insert, erase and
+// unlink are O(log n) and never allocate. Keys are unique; an object whose
+// key compares equal to a linked one is not inserted. An element's key must
+// not change while it is linked: unlink it, change it, insert it again.
+template <class T, set_hook T::*Hook, class Compare = std::less<T>>
+class intrusive_set {
+  template <bool Const>
+  class basic_iterator;
+
+ public:
+  //  Member type
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  //  Member functions
+  intrusive_set() = default;
+  explicit intrusive_set(const Compare &comp);
+  intrusive_set(const intrusive_set &) = delete;
+  intrusive_set(intrusive_set &&s) noexcept;
+  // Unlinks every element; the elements themselves are untouched.
+  ~intrusive_set();
+
+  intrusive_set &operator=(const intrusive_set &) = delete;
+  intrusive_set &operator=(intrusive_set &&s) noexcept;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  // The position of value, which must be linked into this set.
+  iterator iterator_to(reference value);
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  //  Modifiers
+  void clear();
+  // Links value unless an equal key is already linked; returns the
+  // position of value or of the element that blocked it.
+  std::pair<iterator, bool> insert(reference value);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  // Removes value, which must be linked into this set, in O(log n).
+  void unlink(reference value);
+  void swap(intrusive_set &other) noexcept;
+
+  //  Lookup
+  // key may be any type Compare accepts alongside T.
+  template <class Key>
+  iterator find(const Key &key);
+  template <class Key>
+  bool contains(const Key &key);
+  template <class Key>
+  iterator lower_bound(const Key &key);
+
+ private:
+  using hooks = internal::member_hook<T, set_hook, Hook>;
+  using avl = internal::avl<set_hook>;
+
+  set_hook *root_ = nullptr;
+  size_type size_ = 0;
+  Compare comp_{};
+
+  static void reset(set_hook *h);
+  static set_hook *leftmost(set_hook *h);
+  static set_hook *rightmost(set_hook *h);
+  static set_hook *successor(set_hook *h);
+  static set_hook *predecessor(set_hook *h);
+  void replace_child(set_hook *parent, set_hook *old_child,
+                     set_hook *new_child);
+  void rebalance_from(set_hook *h);
+};
+
+// In-order iterator. end() is a null hook; stepping back from it needs the
+// set's root, which the iterator keeps a pointer to.
+template <class T, set_hook T::*Hook, class Compare>
+template <bool Const>
+class intrusive_set<T, Hook, Compare>::basic_iterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  basic_iterator() = default;
+  template <bool C = Const, class = std::enable_if_t<C>>
+  basic_iterator(const basic_iterator<false> &it)
+      : hook_(it.hook_), root_(it.root_) {}
+
+  reference operator*() const { return *hooks::owner(hook_); }
+  pointer operator->() const { return hooks::owner(hook_); }
+
+  basic_iterator &operator++() {
+    hook_ = successor(hook_);
+    return *this;
+  }
+  basic_iterator operator++(int) {
+    basic_iterator old = *this;
+    hook_ = successor(hook_);
+    return old;
+  }
+  basic_iterator &operator--() {
+    hook_ = hook_ ? predecessor(hook_) : rightmost(*root_);
+    return *this;
+  }
+  basic_iterator operator--(int) {
+    basic_iterator old = *this;
+    --*this;
+    return old;
+  }
+
+  friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+    return a.hook_ == b.hook_;
+  }
+  friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+    return a.hook_ != b.hook_;
+  }
+
+ private:
+  friend class intrusive_set;
+  friend class basic_iterator<true>;
+
+  basic_iterator(set_hook *hook, set_hook *const *root)
+      : hook_(hook), root_(root) {}
+
+  set_hook *hook_{};
+  set_hook *const *root_{};
+};
+
+// intrusive_list CONSTRUCTOR
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() {
+  sentinel_.next = sentinel_.prev = &sentinel_;
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&l) noexcept
+    : intrusive_list() {
+  swap(l);
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+  clear();
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(
+    intrusive_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+// Element access
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::front() {
+  return *hooks::owner(sentinel_.next);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::back() {
+  return *hooks::owner(sentinel_.prev);
+}
+
+// Iterators
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() {
+  return iterator(sentinel_.next);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() {
+  return iterator(&sentinel_);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::begin() const {
+  return const_iterator(sentinel_.next);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::end() const {
+  return const_iterator(const_cast<list_hook *>(&sentinel_));
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::iterator_to(reference value) {
+  return iterator(hooks::hook(value));
+}
+
+// Capacity
+
+template <class T, list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size()
+    const {
+  return size_;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type
+intrusive_list<T, Hook>::max_size() const {
+  return std::numeric_limits<size_type>::max();
+}
+
+// Modifiers
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+  list_hook *h = sentinel_.next;
+  while (h != &sentinel_) {
+    list_hook *next = h->next;
+    h->next = h->prev = nullptr;
+    h = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  size_ = 0;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  list_hook *h = hooks::hook(value);
+  link_chain(pos.hook_, h, h);
+  ++size_;
+  return iterator(h);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) {
+  list_hook *next = pos.hook_->next;
+  unlink(*hooks::owner(pos.hook_));
+  return iterator(next);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink(reference value) {
+  list_hook *h = hooks::hook(value);
+  unlink_chain(h, h);
+  h->next = h->prev = nullptr;
+  --size_;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) {
+  insert(end(), value);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  unlink(back());
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) {
+  insert(begin(), value);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  unlink(front());
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept {
+  if (this == &other) return;
+  list_hook *first = sentinel_.next, *last = sentinel_.prev;
+  bool was_empty = size_ == 0;
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  if (!other.empty()) {
+    link_chain(&sentinel_, other.sentinel_.next, other.sentinel_.prev);
+  }
+  other.sentinel_.next = other.sentinel_.prev = &other.sentinel_;
+  if (!was_empty) link_chain(&other.sentinel_, first, last);
+  std::swap(size_, other.size_);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::merge(intrusive_list &other) {
+  merge(other, std::less<T>());
+}
+
+// Walks *this once, splicing each run of other's elements that belongs
+// before the current element; stable, and O(1) per element moved.
+template <class T, list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list &other, Compare comp) {
+  if (&other == this) return;
+  list_hook *pos = sentinel_.next;
+  while (!other.empty()) {
+    if (pos == &sentinel_) {
+      splice(end(), other);
+      return;
+    }
+    list_hook *first = other.sentinel_.next;
+    if (!comp(*hooks::owner(first), *hooks::owner(pos))) {
+      pos = pos->next;
+      continue;
+    }
+    list_hook *last = first;
+    size_type moved = 1;
+    while (last->next != &other.sentinel_ &&
+           comp(*hooks::owner(last->next), *hooks::owner(pos))) {
+      last = last->next;
+      ++moved;
+    }
+    unlink_chain(first, last);
+    link_chain(pos, first, last);
+    size_ += moved;
+    other.size_ -= moved;
+  }
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other) {
+  if (&other == this || other.empty()) return;
+  list_hook *first = other.sentinel_.next, *last = other.sentinel_.prev;
+  other.sentinel_.next = other.sentinel_.prev = &other.sentinel_;
+  link_chain(pos.hook_, first, last);
+  size_ += std::exchange(other.size_, 0);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other,
+                                     const_iterator it) {
+  list_hook *h = it.hook_;
+  if (pos.hook_ == h || pos.hook_ == h->next) return;
+  unlink_chain(h, h);
+  link_chain(pos.hook_, h, h);
+  --other.size_;
+  ++size_;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  if (first == last || pos == last) return;
+  list_hook *chain_first = first.hook_, *chain_last = last.hook_->prev;
+  if (&other != this) {
+    size_type moved = 1;
+    for (list_hook *h = chain_first; h != chain_last; h = h->next) ++moved;
+    other.size_ -= moved;
+    size_ += moved;
+  }
+  unlink_chain(chain_first, chain_last);
+  link_chain(pos.hook_, chain_first, chain_last);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::reverse() {
+  list_hook *h = &sentinel_;
+  do {
+    std::swap(h->next, h->prev);
+    h = h->prev;
+  } while (h != &sentinel_);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::sort() {
+  sort(std::less<T>());
+}
+
+// Bottom-up merge sort: runs[i] holds a sorted run of 2^i elements (or is
+// empty), and each element from *this is carried up through them like a
+// binary counter. Stable, O(n log n), no allocation.
+template <class T, list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+  if (size_ < 2) return;
+  intrusive_list carry;
+  intrusive_list runs[64];
+  size_type used = 0;
+  while (!empty()) {
+    carry.splice(carry.begin(), *this, begin());
+    size_type i = 0;
+    for (; i < used && !runs[i].empty(); ++i) {
+      runs[i].merge(carry, comp);
+      carry.swap(runs[i]);
+    }
+    carry.swap(runs[i]);
+    if (i == used) ++used;
+  }
+  for (size_type i = 1; i < used; ++i) runs[i].merge(runs[i - 1], comp);
+  swap(runs[used - 1]);
+}
+
+// Links
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::link_chain(list_hook *pos, list_hook *first,
+                                         list_hook *last) {
+  first->prev = pos->prev;
+  pos->prev->next = first;
+  last->next = pos;
+  pos->prev = last;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink_chain(list_hook *first, list_hook *last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+// intrusive_set CONSTRUCTOR
+
+template <class T, set_hook T::*Hook, class Compare>
+intrusive_set<T, Hook, Compare>::intrusive_set(const Compare &comp)
+    : comp_(comp) {}
+
+template <class T, set_hook T::*Hook, class Compare>
+intrusive_set<T, Hook, Compare>::intrusive_set(intrusive_set &&s) noexcept
+    : root_(std::exchange(s.root_, nullptr)),
+      size_(std::exchange(s.size_, 0)),
+      comp_(s.comp_) {}
+
+template <class T, set_hook T::*Hook, class Compare>
+intrusive_set<T, Hook, Compare>::~intrusive_set() {
+  clear();
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+intrusive_set<T, Hook, Compare> &intrusive_set<T, Hook, Compare>::operator=(
+    intrusive_set &&s) noexcept {
+  if (this != &s) {
+    clear();
+    swap(s);
+  }
+  return *this;
+}
+
+// Iterators
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::begin() {
+  return iterator(root_ ? leftmost(root_) : nullptr, &root_);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::end() {
+  return iterator(nullptr, &root_);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::const_iterator
+intrusive_set<T, Hook, Compare>::begin() const {
+  return const_iterator(root_ ? leftmost(root_) : nullptr, &root_);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::const_iterator
+intrusive_set<T, Hook, Compare>::end() const {
+  return const_iterator(nullptr, &root_);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::iterator_to(reference value) {
+  return iterator(hooks::hook(value), &root_);
+}
+
+// Capacity
+
+template <class T, set_hook T::*Hook, class Compare>
+bool intrusive_set<T, Hook, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::size_type
+intrusive_set<T, Hook, Compare>::size() const {
+  return size_;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::size_type
+intrusive_set<T, Hook, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max();
+}
+
+// Modifiers
+
+// Resets every hook, children before parents, without recursion: descend
+// to a leaf, reset it, climb to its parent and repeat.
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::clear() {
+  set_hook *h = root_;
+  while (h) {
+    if (h->left) {
+      h = h->left;
+    } else if (h->right) {
+      h = h->right;
+    } else {
+      set_hook *parent = h->parent;
+      if (parent) (parent->left == h ? parent->left : parent->right) = nullptr;
+      reset(h);
+      h = parent;
+    }
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+std::pair<typename intrusive_set<T, Hook, Compare>::iterator, bool>
+intrusive_set<T, Hook, Compare>::insert(reference value) {
+  set_hook *parent = nullptr;
+  set_hook **slot = &root_;
+  while (*slot) {
+    parent = *slot;
+    T &current = *hooks::owner(parent);
+    if (comp_(value, current)) {
+      slot = &parent->left;
+    } else if (comp_(current, value)) {
+      slot = &parent->right;
+    } else {
+      return std::make_pair(iterator(parent, &root_), false);
+    }
+  }
+  set_hook *h = hooks::hook(value);
+  h->left = h->right = nullptr;
+  h->parent = parent;
+  h->height = 1;
+  *slot = h;
+  ++size_;
+  rebalance_from(parent);
+  return std::make_pair(iterator(h, &root_), true);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::erase(const_iterator pos) {
+  set_hook *next = successor(pos.hook_);
+  unlink(*hooks::owner(pos.hook_));
+  return iterator(next, &root_);
+}
+
+// Relinks rather than copying values: a node with two children is replaced
+// by its successor, which is moved into its place.
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::unlink(reference value) {
+  set_hook *z = hooks::hook(value);
+  set_hook *from;
+  if (!z->left || !z->right) {
+    set_hook *child = z->left ? z->left : z->right;
+    replace_child(z->parent, z, child);
+    if (child) child->parent = z->parent;
+    from = z->parent;
+  } else {
+    set_hook *s = leftmost(z->right);
+    if (s->parent != z) {
+      from = s->parent;
+      s->parent->left = s->right;
+      if (s->right) s->right->parent = s->parent;
+      s->right = z->right;
+      z->right->parent = s;
+    } else {
+      from = s;
+    }
+    s->left = z->left;
+    z->left->parent = s;
+    s->parent = z->parent;
+    replace_child(z->parent, z, s);
+    s->height = z->height;
+  }
+  reset(z);
+  --size_;
+  rebalance_from(from);
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::swap(intrusive_set &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+// Lookup
+
+template <class T, set_hook T::*Hook, class Compare>
+template <class Key>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::find(const Key &key) {
+  iterator it = lower_bound(key);
+  if (it != end() && comp_(key, *it)) return end();
+  return it;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+template <class Key>
+bool intrusive_set<T, Hook, Compare>::contains(const Key &key) {
+  return find(key) != end();
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+template <class Key>
+typename intrusive_set<T, Hook, Compare>::iterator
+intrusive_set<T, Hook, Compare>::lower_bound(const Key &key) {
+  set_hook *h = root_, *result = nullptr;
+  while (h) {
+    if (comp_(*hooks::owner(h), key)) {
+      h = h->right;
+    } else {
+      result = h;
+      h = h->left;
+    }
+  }
+  return iterator(result, &root_);
+}
+
+// Tree
+
+// Assignment leaves a hook alone (see set_hook), so unlinking clears the
+// fields by hand.
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::reset(set_hook *h) {
+  h->left = h->right = h->parent = nullptr;
+  h->height = 0;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+set_hook *intrusive_set<T, Hook, Compare>::leftmost(set_hook *h) {
+  while (h->left) h = h->left;
+  return h;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+set_hook *intrusive_set<T, Hook, Compare>::rightmost(set_hook *h) {
+  while (h->right) h = h->right;
+  return h;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+set_hook *intrusive_set<T, Hook, Compare>::successor(set_hook *h) {
+  if (h->right) return leftmost(h->right);
+  while (h->parent && h == h->parent->right) h = h->parent;
+  return h->parent;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+set_hook *intrusive_set<T, Hook, Compare>::predecessor(set_hook *h) {
+  if (h->left) return rightmost(h->left);
+  while (h->parent && h == h->parent->left) h = h->parent;
+  return h->parent;
+}
+
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::replace_child(set_hook *parent,
+                                                    set_hook *old_child,
+                                                    set_hook *new_child) {
+  if (!parent) {
+    root_ = new_child;
+  } else if (parent->left == old_child) {
+    parent->left = new_child;
+  } else {
+    parent->right = new_child;
+  }
+}
+
+// Walks from h to the root fixing heights and rotating where a subtree has
+// gone out of balance.
+template <class T, set_hook T::*Hook, class Compare>
+void intrusive_set<T, Hook, Compare>::rebalance_from(set_hook *h) {
+  for (; h; h = h->parent) {
+    avl::update_height(h);
+    h = avl::rebalance(h, root_);
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_INTRUSIVE_H
@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "s21_intrusive.h"
+
+namespace {
+
+// One object, four memberships.
+struct order {
+  explicit order(int id = 0, int price = 0) : id(id), price(price) {}
+
+  int id;
+  int price;
+  s21::list_hook by_age;
+  s21::list_hook in_batch;
+  s21::set_hook by_price;
+  s21::set_hook by_id;
+};
+
+struct price_then_id {
+  bool operator()(const order &a, const order &b) const {
+    return a.price < b.price || (a.price == b.price && a.id < b.id);
+  }
+};
+
+// Transparent, so the set can be searched by a bare id.
+struct id_less {
+  bool operator()(const order &a, const order &b) const { return a.id < b.id; }
+  bool operator()(const order &a, int id) const { return a.id < id; }
+  bool operator()(int id, const order &b) const { return id < b.id; }
+};
+
+struct by_price_only {
+  bool operator()(const order &a, const order &b) const {
+    return a.price < b.price;
+  }
+};
+
+using age_list = s21::intrusive_list<order, &order::by_age>;
+using batch_list = s21::intrusive_list<order, &order::in_batch>;
+using price_set = s21::intrusive_set<order, &order::by_price, price_then_id>;
+using id_set = s21::intrusive_set<order, &order::by_id, id_less>;
+
+template <class List>
+std::vector<int> ids(const List &l) {
+  std::vector<int> out;
+  for (const order &o : l) out.push_back(o.id);
+  return out;
+}
+
+template <class List>
+std::vector<int> ids_backwards(const List &l) {
+  std::vector<int> out;
+  for (auto it = l.end(); it != l.begin();) out.push_back((--it)->id);
+  return out;
+}
+
+// Checks the parent links, the stored heights and the AVL balance of the
+// subtree under h, and returns its height.
+int check_avl(const s21::set_hook *h) {
+  if (!h) return 0;
+  if (h->left) {
+    EXPECT_EQ(h->left->parent, h);
+  }
+  if (h->right) {
+    EXPECT_EQ(h->right->parent, h);
+  }
+  int left = check_avl(h->left);
+  int right = check_avl(h->right);
+  EXPECT_LE(std::abs(left - right), 1);
+  EXPECT_EQ(h->height, std::max(left, right) + 1);
+  return std::max(left, right) + 1;
+}
+
+template <class Set>
+void check_tree(Set &s) {
+  if (s.empty()) return;
+  const s21::set_hook *h = &s.begin()->by_id;
+  while (h->parent) h = h->parent;
+  check_avl(h);
+}
+
+}  // namespace
+
+TEST(intrusive_list_suite, links_objects_in_place) {
+  std::vector<order> arena;
+  for (int i = 0; i < 6; ++i) arena.emplace_back(i);
+  age_list ages;
+  EXPECT_TRUE(ages.empty());
+  for (order &o : arena) ages.push_back(o);
+  EXPECT_EQ(ages.size(), static_cast<size_t>(6));
+  EXPECT_EQ(&ages.front(), &arena[0]);
+  EXPECT_EQ(&ages.back(), &arena[5]);
+
+  ages.unlink(arena[2]);
+  EXPECT_FALSE(arena[2].by_age.is_linked());
+  auto it = ages.erase(ages.iterator_to(arena[4]));
+  EXPECT_EQ(&*it, &arena[5]);
+  ages.insert(it, arena[2]);
+  ages.pop_front();
+  ages.push_front(arena[4]);
+  ages.pop_back();
+  EXPECT_EQ(ids(ages), std::vector<int>({4, 1, 3, 2}));
+  EXPECT_EQ(ids_backwards(ages), std::vector<int>({2, 3, 1, 4}));
+  EXPECT_FALSE(arena[0].by_age.is_linked());
+  EXPECT_TRUE(arena[1].by_age.is_linked());
+
+  ages.clear();
+  EXPECT_TRUE(ages.empty());
+  for (const order &o : arena) EXPECT_FALSE(o.by_age.is_linked());
+}
+
+TEST(intrusive_list_suite, one_object_in_two_lists) {
+  order a(1), b(2), c(3);
+  age_list ages;
+  batch_list batch;
+  ages.push_back(a);
+  ages.push_back(b);
+  ages.push_back(c);
+  batch.push_back(c);
+  batch.push_back(a);
+  ages.unlink(c);
+  EXPECT_EQ(ids(ages), std::vector<int>({1, 2}));
+  EXPECT_EQ(ids(batch), std::vector<int>({3, 1}));
+  EXPECT_TRUE(c.in_batch.is_linked());
+
+  order copy = a;
+  EXPECT_EQ(copy.id, 1);
+  EXPECT_FALSE(copy.by_age.is_linked());
+  EXPECT_FALSE(copy.in_batch.is_linked());
+  {
+    batch_list moved(std::move(batch));
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(ids(moved), std::vector<int>({3, 1}));
+  }
+  EXPECT_FALSE(a.in_batch.is_linked());
+  EXPECT_FALSE(c.in_batch.is_linked());
+}
+
+TEST(intrusive_list_suite, splice_merge_sort_reverse) {
+  std::vector<order> arena;
+  std::mt19937 rng(5);
+  for (int i = 0; i < 300; ++i) {
+    arena.emplace_back(i, static_cast<int>(rng() % 25));
+  }
+  age_list a, b;
+  for (int i = 0; i < 300; ++i) (i % 4 == 0 ? b : a).push_back(arena[i]);
+  a.sort(by_price_only());
+  b.sort(by_price_only());
+  a.merge(b, by_price_only());
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), static_cast<size_t>(300));
+  std::vector<order *> expected;
+  for (order &o : arena) expected.push_back(&o);
+  // a's elements first among equal prices, each side in id order.
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const order *x, const order *y) {
+                     if (x->price != y->price) return x->price < y->price;
+                     return (x->id % 4 != 0) > (y->id % 4 != 0);
+                   });
+  auto it = a.begin();
+  for (order *o : expected) EXPECT_EQ(&*it++, o);
+
+  a.reverse();
+  EXPECT_EQ(&a.front(), expected.back());
+  EXPECT_EQ(&*--a.end(), expected.front());
+
+  b.splice(b.end(), a, a.begin());
+  b.splice(b.begin(), a, std::next(a.begin(), 10), std::next(a.begin(), 20));
+  EXPECT_EQ(a.size(), static_cast<size_t>(289));
+  EXPECT_EQ(b.size(), static_cast<size_t>(11));
+  EXPECT_EQ(&b.back(), expected.back());
+  a.splice(a.begin(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), static_cast<size_t>(300));
+  a.splice(a.end(), a, a.begin(), std::next(a.begin(), 11));
+  EXPECT_EQ(&a.back(), expected.back());
+  EXPECT_EQ(ids(a).size(), static_cast<size_t>(300));
+}
+
+TEST(intrusive_set_suite, matches_std_set_and_stays_balanced) {
+  std::vector<order> arena;
+  for (int i = 0; i < 2000; ++i) arena.emplace_back(i);
+  id_set s;
+  std::set<int> expected;
+  std::mt19937 rng(11);
+  for (int round = 0; round < 20000; ++round) {
+    order &o = arena[rng() % arena.size()];
+    if (o.by_id.is_linked()) {
+      s.unlink(o);
+      expected.erase(o.id);
+    } else {
+      EXPECT_TRUE(s.insert(o).second);
+      expected.insert(o.id);
+    }
+    ASSERT_EQ(s.size(), expected.size());
+    if (round % 1000 == 0) check_tree(s);
+  }
+  check_tree(s);
+  EXPECT_EQ(ids(s), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_EQ(ids_backwards(s),
+            std::vector<int>(expected.rbegin(), expected.rend()));
+}
+
+TEST(intrusive_set_suite, lookup_duplicates_and_erase) {
+  order a(10), b(20), c(30), d(40), dup(20);
+  id_set s;
+  for (order *o : {&c, &a, &d, &b}) s.insert(*o);
+  auto result = s.insert(dup);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(&*result.first, &b);
+  EXPECT_FALSE(dup.by_id.is_linked());
+
+  EXPECT_EQ(&*s.find(30), &c);
+  EXPECT_EQ(s.find(25), s.end());
+  EXPECT_TRUE(s.contains(40));
+  EXPECT_FALSE(s.contains(41));
+  EXPECT_EQ(&*s.lower_bound(25), &c);
+  EXPECT_EQ(s.lower_bound(41), s.end());
+  EXPECT_EQ(&*--s.end(), &d);
+
+  auto next = s.erase(s.find(20));
+  EXPECT_EQ(&*next, &c);
+  EXPECT_EQ(s.erase(s.iterator_to(d)), s.end());
+  EXPECT_EQ(ids(s), std::vector<int>({10, 30}));
+  EXPECT_TRUE(s.insert(dup).second);
+  EXPECT_EQ(ids(s), std::vector<int>({10, 20, 30}));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_FALSE(a.by_id.is_linked());
+  EXPECT_FALSE(dup.by_id.is_linked());
+}
+
+TEST(intrusive_set_suite, one_object_in_a_list_and_two_sets) {
+  std::vector<order> arena;
+  std::mt19937 rng(2);
+  for (int i = 0; i < 100; ++i) {
+    arena.emplace_back(i, static_cast<int>(rng() % 10));
+  }
+  age_list ages;
+  price_set prices;
+  id_set by_id;
+  for (order &o : arena) {
+    ages.push_back(o);
+    prices.insert(o);
+    by_id.insert(o);
+  }
+  // Reprice the oldest half: out of the price index, change, back in, and
+  // to the back of the age list; the id index is not touched.
+  for (int i = 0; i < 50; ++i) {
+    order &o = ages.front();
+    prices.unlink(o);
+    o.price += 100;
+    prices.insert(o);
+    ages.pop_front();
+    ages.push_back(o);
+  }
+  EXPECT_EQ(ages.front().id, 50);
+  EXPECT_EQ(ages.back().id, 49);
+  EXPECT_EQ(by_id.size(), static_cast<size_t>(100));
+  EXPECT_EQ(&*by_id.find(7), &arena[7]);
+  const order *previous = nullptr;
+  for (const order &o : prices) {
+    if (previous) {
+      EXPECT_TRUE(price_then_id()(*previous, o));
+    }
+    previous = &o;
+  }
+  EXPECT_GE(prices.begin()->id, 50);
+  EXPECT_GE((--prices.end())->price, 100);
+
+  price_set moved(std::move(prices));
+  EXPECT_TRUE(prices.empty());
+  EXPECT_EQ(moved.size(), static_cast<size_t>(100));
+  moved.swap(prices);
+  EXPECT_EQ(prices.size(), static_cast<size_t>(100));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
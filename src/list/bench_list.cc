@@ -0,0 +1,129 @@
+#define S21_BENCH_COUNT_ALLOCATIONS
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "../allocator/s21_allocator.h"
+#include "../bench/s21_bench.h"
+#include "../queue/s21_queue.h"
+#include "../stack/s21_stack.h"
+#include "s21_list.h"
+
+namespace {
+
+const int kReps = 5;
+
+struct record {
+  std::uint64_t key;
+  double payload[7];
+  bool operator<(const record &other) const { return key < other.key; }
+};
+
+int make(std::uint64_t key, int *) { return static_cast<int>(key); }
+record make(std::uint64_t key, record *) { return record{key, {}}; }
+
+// Times sort() on an s21::list and a std::list of the same keys. The two
+// lists are filled in lockstep for every run, so their nodes are equally
+// scattered across the heap and neither gets the fresher memory.
+template <class T>
+void sort(const char *s21_name, const char *std_name,
+          const std::vector<std::uint64_t> &keys) {
+  double best[2] = {0, 0};
+  for (int rep = 0; rep < kReps; ++rep) {
+    s21::list<T> ours;
+    std::list<T> theirs;
+    for (std::uint64_t k : keys) {
+      ours.push_back(make(k, static_cast<T *>(nullptr)));
+      theirs.push_back(make(k, static_cast<T *>(nullptr)));
+    }
+    double ns[2] = {s21::bench::measure(1, [&ours] { ours.sort(); }),
+                    s21::bench::measure(1, [&theirs] { theirs.sort(); })};
+    s21::bench::do_not_optimize(ours.front());
+    s21::bench::do_not_optimize(theirs.front());
+    for (int i = 0; i < 2; ++i) {
+      if (rep == 0 || ns[i] < best[i]) best[i] = ns[i];
+    }
+  }
+  s21::bench::report(s21_name, keys.size(), best[0]);
+  s21::bench::report(std_name, keys.size(), best[1]);
+}
+
+// Times merge() of two sorted lists of n/2 keys each, filled in lockstep
+// like sort() above.
+void merge(const std::vector<std::uint64_t> &keys) {
+  std::vector<std::uint64_t> sorted(keys);
+  std::sort(sorted.begin(), sorted.end());
+  double best[2] = {0, 0};
+  for (int rep = 0; rep < kReps; ++rep) {
+    s21::list<int> ours[2];
+    std::list<int> theirs[2];
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+      ours[i % 2].push_back(static_cast<int>(sorted[i]));
+      theirs[i % 2].push_back(static_cast<int>(sorted[i]));
+    }
+    double ns[2] = {
+        s21::bench::measure(1, [&ours] { ours[0].merge(ours[1]); }),
+        s21::bench::measure(1, [&theirs] { theirs[0].merge(theirs[1]); })};
+    for (int i = 0; i < 2; ++i) {
+      if (rep == 0 || ns[i] < best[i]) best[i] = ns[i];
+    }
+  }
+  s21::bench::report("s21::list<int> merge", keys.size(), best[0]);
+  s21::bench::report("std::list<int> merge", keys.size(), best[1]);
+}
+
+// Steady state: the container holds kLive elements and each cycle pushes
+// one and pops one. Reports the time per cycle and the allocations made by
+// the timed cycles.
+template <class Container, class Push, class Pop>
+void cycle(const char *name, Push push, Pop pop) {
+  const std::size_t kLive = 1000;
+  const std::size_t kCycles = std::size_t(1) << 20;
+  Container c;
+  for (std::size_t i = 0; i < kLive; ++i) push(c, static_cast<int>(i));
+  std::size_t before = s21::bench::allocations;
+  double ns = s21::bench::measure(kReps, [&c, &push, &pop, kCycles] {
+    for (std::size_t i = 0; i < kCycles; ++i) {
+      push(c, static_cast<int>(i));
+      pop(c);
+    }
+  });
+  std::size_t made = s21::bench::allocations - before;
+  s21::bench::report(name, kLive, kCycles, ns);
+  std::printf("      allocations per cycle: %.3f\n",
+              static_cast<double>(made) / (kCycles * kReps));
+}
+
+}  // namespace
+
+int main() {
+  using pooled_list = s21::list<int, s21::pool_allocator<int>>;
+  auto push_back = [](auto &c, int v) { c.push_back(v); };
+  auto pop_front = [](auto &c) { c.pop_front(); };
+  auto push = [](auto &c, int v) { c.push(v); };
+  auto pop = [](auto &c) { c.pop(); };
+  cycle<std::list<int>>("std::list<int> push_back+pop_front", push_back,
+                        pop_front);
+  cycle<s21::list<int>>("s21::list<int> push_back+pop_front", push_back,
+                        pop_front);
+  cycle<pooled_list>("s21::list<int, pool> push_back+pop_front", push_back,
+                     pop_front);
+  cycle<s21::queue<int, pooled_list>>(
+      "s21::queue<int, pooled list> push+pop_front", push, pop_front);
+  cycle<s21::stack<int, pooled_list>>("s21::stack<int, pooled list> push+pop",
+                                      push, pop);
+
+  std::mt19937_64 rng(1);
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 20}) {
+    std::vector<std::uint64_t> keys(n);
+    for (std::uint64_t &k : keys) k = rng() >> 33;
+    sort<int>("s21::list<int> sort", "std::list<int> sort", keys);
+    sort<record>("s21::list<record> sort", "std::list<record> sort", keys);
+    merge(keys);
+  }
+  return 0;
+}
@@ -1,11 +1,20 @@
 #ifndef CPP2_S21_CONTAINERS_1_LIST_H
 #define CPP2_S21_CONTAINERS_1_LIST_H
 
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace s21 {
-template <class T>
+// Doubly linked list with a sentinel end node. Nodes come from Allocator
+// rebound to the node type, so s21::pool_allocator (allocator/
+// s21_allocator.h) recycles them through a free list instead of calling
+// operator new per element; s21::queue and s21::stack get the same by
+// using such a list as their Container. splice() and merge() move nodes
+// between lists, which needs both lists' allocators to compare equal.
+template <class T, class Allocator = std::allocator<T>>
 class list {
  public:
   // Member type
@@ -13,6 +22,7 @@ class list {
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
   class ListIterator;
   using iterator = ListIterator;
@@ -20,6 +30,7 @@ class list {
 
   // Functions
   list();
+  explicit list(const Allocator& alloc);
   explicit list(size_type n);
   list(std::initializer_list<value_type> const& items);
   list(const list& l);
@@ -28,6 +39,8 @@ class list {
   list& operator=(list&& l) noexcept;
   ~list();
 
+  allocator_type get_allocator() const;
+
   // Element access
   const_reference front();
   const_reference back();
@@ -51,10 +64,17 @@ class list {
   void pop_front();
   void swap(list& other);
   void merge(list& other);
+  template <class Compare>
+  void merge(list& other, Compare comp);
   void splice(const_iterator pos, list& other);
+  void splice(const_iterator pos, list& other, const_iterator it);
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last);
   void reverse();
   void unique();
   void sort();
+  template <class Compare>
+  void sort(Compare comp);
 
   // Modifiers DOP
   template <class... Args>
@@ -79,11 +99,35 @@ class list {
   node* end_node_ = nullptr;
 
   size_t size_ = 0;
+
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator alloc_{};
+
+  template <class... Args>
+  node* create_node(Args&&... args);
+  void destroy_node(node* n);
+
+  // A sorted chain linked through next and ending in nullptr. Every node but
+  // first also has a correct prev.
+  struct run {
+    node* first;
+    node* last;
+  };
+
+  template <class Compare>
+  static run merge_runs(run left, run right, Compare& comp);
+  static void link_after(node* last, node* next);
+  void relink(run chain);
+  void attach(node* pos, node* first, node* last);
+  void detach(node* first, node* last);
 };
 
-template <class T>
-class list<T>::ListIterator {
-  friend class list<T>;
+template <class T, class Allocator>
+class list<T, Allocator>::ListIterator {
+  friend class list<T, Allocator>;
 
  public:
   ListIterator() = default;
@@ -94,68 +138,83 @@ class list<T>::ListIterator {
   void operator++(int);
   ListIterator operator--();
   void operator--(int);
-  bool operator==(list<T>::ListIterator iterator) const;
-  bool operator!=(list<T>::ListIterator iterator) const;
+  bool operator==(list<T, Allocator>::ListIterator iterator) const;
+  bool operator!=(list<T, Allocator>::ListIterator iterator) const;
 
  private:
-  node* node_;
+  node* node_ = nullptr;
 };
 
 ////////////////////////////////// Constructor ///////////////////////////////
-template <class T>
-list<T>::list() : head_(nullptr), tail_(nullptr), size_(0) {
-  end_node_ = new node;
+template <class T, class Allocator>
+list<T, Allocator>::list() : head_(nullptr), tail_(nullptr), size_(0) {
+  end_node_ = create_node();
+}
+
+template <class T, class Allocator>
+list<T, Allocator>::list(const Allocator& alloc) : alloc_(alloc) {
+  end_node_ = create_node();
 }
 
-template <class T>
-list<T>::list(size_type n) : list() {
+template <class T, class Allocator>
+list<T, Allocator>::list(size_type n) : list() {
   for (size_type i = 0; i < n; ++i) {
     push_back(T{});
   }
 }
 
-template <class T>
-list<T>::list(std::initializer_list<value_type> const& items)
+template <class T, class Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const& items)
     : head_(nullptr), tail_(nullptr), size_(0) {
-  end_node_ = new node;
+  end_node_ = create_node();
   for (const auto& item : items) {
     push_back(item);
   }
 }
 
-template <class T>
-list<T>::list(const list& l) {
-  end_node_ = new node;
+template <class T, class Allocator>
+list<T, Allocator>::list(const list& l)
+    : alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
+  end_node_ = create_node();
   for (auto i = l.begin(); i != l.end(); ++i) {
     push_back(*i);
   }
 }
 
-template <class T>
-list<T>::list(list&& l) noexcept {
-  swap(l);
-}
+template <class T, class Allocator>
+list<T, Allocator>::list(list&& l) noexcept
+    : head_(std::exchange(l.head_, nullptr)),
+      tail_(std::exchange(l.tail_, nullptr)),
+      end_node_(std::exchange(l.end_node_, nullptr)),
+      size_(std::exchange(l.size_, 0)),
+      alloc_(l.alloc_) {}
 
-template <class T>
-list<T>::~list() {
+template <class T, class Allocator>
+list<T, Allocator>::~list() {
   clear();
-  delete end_node_;
+  if (end_node_) {
+    destroy_node(end_node_);
+  }
+}
+
+template <class T, class Allocator>
+typename list<T, Allocator>::allocator_type
+list<T, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
 }
 
 //////////////////////////// Operators Constructor ///////////////////////////
-template <class T>
-list<T>& list<T>::operator=(const list& l) {
+template <class T, class Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(const list& l) {
   if (this != &l) {
-    clear();
-    for (auto i = l.begin(); i != l.end(); ++i) {
-      push_back(*i);
-    }
+    list copy(l);
+    swap(copy);
   }
   return *this;
 }
 
-template <class T>
-list<T>& list<T>::operator=(list&& l) noexcept {
+template <class T, class Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& l) noexcept {
   if (this == &l) {
     return *this;
   }
@@ -165,9 +224,9 @@ list<T>& list<T>::operator=(list&& l) noexcept {
 }
 
 ////////////////////////////////// Modifiers //////////////////////////////////
-template <class T>
-void list<T>::push_back(const_reference value) {
-  auto* new_node = new node(end_node_, nullptr, value);
+template <class T, class Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  auto* new_node = create_node(end_node_, nullptr, value);
   if (!head_) {
     head_ = new_node;
     tail_ = new_node;
@@ -181,12 +240,13 @@ void list<T>::push_back(const_reference value) {
   ++size_;
 }
 
-template <class T>
-void list<T>::push_front(const_reference value) {
-  auto* new_node = new node(head_, nullptr, value);
+template <class T, class Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  auto* new_node = create_node(head_ ? head_ : end_node_, nullptr, value);
   if (!head_) {
     head_ = new_node;
     tail_ = new_node;
+    end_node_->prev = tail_;
   } else {
     head_->prev = new_node;
     head_ = new_node;
@@ -195,83 +255,99 @@ void list<T>::push_front(const_reference value) {
   ++size_;
 }
 
-template <class T>
-void list<T>::pop_back() {
+template <class T, class Allocator>
+void list<T, Allocator>::pop_back() {
   if (!head_) {
     return;
   }
 
   auto* old_tail_ = tail_;
   if (head_ == tail_) {
-    head_ = end_node_;
-    tail_ = end_node_;
+    // Back to the state of a new list, so push_back() relinks the sentinel.
+    head_ = nullptr;
+    tail_ = nullptr;
+    end_node_->next = nullptr;
+    end_node_->prev = nullptr;
   } else {
     tail_ = tail_->prev;
     end_node_->prev = tail_;
     tail_->next = end_node_;
   }
-  delete old_tail_;
+  destroy_node(old_tail_);
   --size_;
 }
 
-template <class T>
-void list<T>::pop_front() {
+template <class T, class Allocator>
+void list<T, Allocator>::pop_front() {
   if (!head_ || head_ == end_node_) {
     return;
   }
   auto* old_head = head_;
   if (head_ == tail_) {
-    head_ = end_node_;
-    tail_ = end_node_;
+    head_ = nullptr;
+    tail_ = nullptr;
+    end_node_->prev = nullptr;
   } else {
     head_ = head_->next;
     head_->prev = nullptr;
   }
   end_node_->next = head_;
-  delete old_head;
+  destroy_node(old_head);
   --size_;
 }
 
-template <class T>
-void s21::list<T>::clear() {
-  while (!empty()) {
-    pop_front();
+template <class T, class Allocator>
+void s21::list<T, Allocator>::clear() {
+  if (empty()) {
+    return;
   }
+  node* current = head_;
+  for (size_type i = 0; i < size_; ++i) {
+    node* next = current->next;
+    destroy_node(current);
+    current = next;
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+  end_node_->next = nullptr;
+  end_node_->prev = nullptr;
+  size_ = 0;
 }
 
-template <class T>
-void list<T>::swap(list& other) {
+template <class T, class Allocator>
+void list<T, Allocator>::swap(list& other) {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(end_node_, other.end_node_);
   std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template <class T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
+template <class T, class Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, const_reference value) {
   node* tmp = nullptr;
   iterator itr;
   if (size_ == 0) {
-    tmp = new node(end_node_, nullptr, value);
+    tmp = create_node(end_node_, nullptr, value);
     head_ = tmp;
     tail_ = tmp;
     end_node_->prev = tail_;
 
     end_node_->next = head_;
   } else if (pos == begin()) {
-    tmp = new node(head_, nullptr, value);
+    tmp = create_node(head_, nullptr, value);
     head_->prev = tmp;
     head_ = tmp;
 
     end_node_->next = head_;
   } else if (pos == end()) {
-    tmp = new node(end_node_, tail_, value);
+    tmp = create_node(end_node_, tail_, value);
     tail_->next = tmp;
     tail_ = tmp;
     end_node_->prev = tail_;
   } else {
-    tmp = new node(pos.node_, pos.node_->prev, value);
+    tmp = create_node(pos.node_, pos.node_->prev, value);
     pos.node_->prev->next = tmp;
     pos.node_->prev = tmp;
   }
@@ -280,75 +356,116 @@ typename list<T>::iterator list<T>::insert(iterator pos,
   return itr;
 }
 
-template <class T>
-void list<T>::splice(const_iterator pos, list& other) {
-  if (this == &other) {
+// The splices move nodes between lists without allocating or copying. The
+// whole-list and single-element forms are O(1); the range form is O(k) only
+// to count the nodes when they change lists.
+template <class T, class Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other) {
+  if (this == &other || other.empty()) {
     return;
   }
-  while (!other.empty()) {
-    insert(pos, front());
-    other.pop_front();
+  node* first = other.head_;
+  node* last = other.tail_;
+  other.detach(first, last);
+  attach(pos.node_, first, last);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <class T, class Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other,
+                                const_iterator it) {
+  node* moved = it.node_;
+  if (moved == other.end_node_ || moved == pos.node_) {
+    return;
   }
+  other.detach(moved, moved);
+  attach(pos.node_, moved, moved);
+  --other.size_;
+  ++size_;
 }
 
-template <class T>
-void list<T>::erase(list::iterator pos) {
-  node* current = pos.node_;
-  if (current == nullptr || current == end_node_) {
+template <class T, class Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other,
+                                const_iterator first, const_iterator last) {
+  if (first == last) {
     return;
   }
-  if (current->prev) {
-    current->prev->next = current->next;
-  } else {
-    head_ = current->next;
-    end_node_->next = head_;
+  node* last_moved =
+      last.node_ == other.end_node_ ? other.tail_ : last.node_->prev;
+  if (this != &other) {
+    size_type count = 1;
+    for (node* n = first.node_; n != last_moved; n = n->next) ++count;
+    other.size_ -= count;
+    size_ += count;
   }
-  if (current->next) {
-    current->next->prev = current->prev;
-  } else {
-    tail_ = current->prev;
+  other.detach(first.node_, last_moved);
+  attach(pos.node_, first.node_, last_moved);
+}
+
+template <class T, class Allocator>
+void list<T, Allocator>::erase(list::iterator pos) {
+  node* current = pos.node_;
+  if (current == nullptr || current == end_node_) {
+    return;
   }
-  delete current;
+  detach(current, current);
+  destroy_node(current);
   --size_;
 }
 
-template <class T>
-void list<T>::reverse() {
+template <class T, class Allocator>
+void list<T, Allocator>::reverse() {
   if (!head_ || !head_->next) return;
   node* current = head_;
-  while (current) {
-    node* tmp = current->prev;
+  while (current != end_node_) {
     node* next_node = current->next;
-    current->next = tmp;
-    current->prev = next_node;
+    std::swap(current->next, current->prev);
     current = next_node;
   }
   std::swap(head_, tail_);
+  head_->prev = nullptr;
   tail_->next = end_node_;
+  end_node_->next = head_;
   end_node_->prev = tail_;
 }
 
-template <class T>
-void list<T>::sort() {
-  if (size_ < 2) return;
-
-  for (iterator itr = begin(); itr != end(); ++itr) {
-    T val = *itr;
-    iterator next_pos = itr;
-    ++next_pos;
-    erase(itr);
+template <class T, class Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<T>());
+}
 
-    iterator insert_pos = begin();
-    while (insert_pos != end() && *insert_pos <= val) {
-      ++insert_pos;
+// Bottom-up merge sort: runs[k] holds a sorted run of 2^k nodes, and each
+// node is carried into the runs like a bit into a binary counter, so no
+// pass walks the list to find a midpoint. Equal elements keep their order,
+// and nodes are relinked rather than copied or allocated.
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  run runs[64] = {};
+  node* current = head_;
+  for (size_type i = 0; i < size_; ++i) {
+    node* next = current->next;
+    current->next = nullptr;
+    run carry{current, current};
+    size_type k = 0;
+    for (; runs[k].first; ++k) {
+      carry = merge_runs(runs[k], carry, comp);
+      runs[k] = run{};
     }
-    insert(insert_pos, val);
-    itr = next_pos;
+    runs[k] = carry;
+    current = next;
+  }
+  run sorted{};
+  for (const run& r : runs) {
+    if (r.first) sorted = sorted.first ? merge_runs(r, sorted, comp) : r;
   }
+  relink(sorted);
 }
 
-template <class T>
-void list<T>::unique() {
+template <class T, class Allocator>
+void list<T, Allocator>::unique() {
   if (size_ < 2) return;
 
   iterator itr = begin();
@@ -367,27 +484,159 @@ void list<T>::unique() {
   }
 }
 
-template <class T>
-void list<T>::merge(list& other) {
-  if (this != &other && !other.empty()) {
-    while (!other.empty()) {
-      push_back(*other.begin());
-      other.erase(other.begin());
+template <class T, class Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<T>());
+}
+
+// Merges two sorted lists in one linear pass by relinking nodes; on ties the
+// elements of this list stay first. other is left empty.
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this == &other || other.empty()) {
+    return;
+  }
+  if (empty()) {
+    splice(end(), other);
+    return;
+  }
+  run mine{head_, tail_};
+  run theirs{other.head_, other.tail_};
+  other.detach(theirs.first, theirs.last);
+  mine.last->next = nullptr;
+  theirs.last->next = nullptr;
+  relink(merge_runs(mine, theirs, comp));
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+/////////////////////////////////// Nodes ///////////////////////////////////
+template <class T, class Allocator>
+template <class... Args>
+typename list<T, Allocator>::node* list<T, Allocator>::create_node(
+    Args&&... args) {
+  node* n = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, n, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, n, 1);
+    throw;
+  }
+  return n;
+}
+
+template <class T, class Allocator>
+void list<T, Allocator>::destroy_node(node* n) {
+  node_traits::destroy(alloc_, n);
+  node_traits::deallocate(alloc_, n, 1);
+}
+
+// Merges two non-empty runs; on ties the node from left, which came first,
+// goes first. Links are written only where the merge switches from one run
+// to the other: inside a stretch taken from one run they are already right,
+// so long stretches leave their nodes' cache lines clean.
+template <class T, class Allocator>
+template <class Compare>
+typename list<T, Allocator>::run list<T, Allocator>::merge_runs(
+    run left, run right, Compare& comp) {
+  node* a = left.first;
+  node* b = right.first;
+  bool from_b = comp(b->value, a->value);
+  node* first = from_b ? b : a;
+  node* last = first;
+  if (from_b) {
+    b = b->next;
+  } else {
+    a = a->next;
+  }
+  while (a && b) {
+    if (comp(b->value, a->value)) {
+      if (!from_b) link_after(last, b);
+      from_b = true;
+      last = b;
+      b = b->next;
+    } else {
+      if (from_b) link_after(last, a);
+      from_b = false;
+      last = a;
+      a = a->next;
     }
   }
+  link_after(last, a ? a : b);
+  return {first, a ? left.last : right.last};
+}
+
+template <class T, class Allocator>
+void list<T, Allocator>::link_after(node* last, node* next) {
+  last->next = next;
+  next->prev = last;
+}
+
+// Makes chain the whole list: sets head_, tail_ and the sentinel around it.
+template <class T, class Allocator>
+void list<T, Allocator>::relink(run chain) {
+  head_ = chain.first;
+  tail_ = chain.last;
+  head_->prev = nullptr;
+  tail_->next = end_node_;
+  end_node_->next = head_;
+  end_node_->prev = tail_;
+}
+
+// Links the chain first..last, joined through next and prev, in before pos
+// (which may be the sentinel).
+template <class T, class Allocator>
+void list<T, Allocator>::attach(node* pos, node* first, node* last) {
+  node* prev = pos == end_node_ ? tail_ : pos == head_ ? nullptr : pos->prev;
+  first->prev = prev;
+  last->next = pos;
+  if (prev) {
+    prev->next = first;
+  } else {
+    head_ = first;
+  }
+  if (pos == end_node_) {
+    tail_ = last;
+  } else {
+    pos->prev = last;
+  }
+  end_node_->next = head_;
+  end_node_->prev = tail_;
+}
+
+// Unlinks first..last from the list, leaving the nodes themselves (and
+// size_) untouched. The head's prev stays nullptr and an emptied list gets
+// the null links of a new one.
+template <class T, class Allocator>
+void list<T, Allocator>::detach(node* first, node* last) {
+  node* prev = first == head_ ? nullptr : first->prev;
+  node* next = last == tail_ ? nullptr : last->next;
+  if (prev) {
+    prev->next = last == tail_ ? end_node_ : next;
+  } else {
+    head_ = next;
+  }
+  if (next) {
+    next->prev = prev;
+  } else {
+    tail_ = prev;
+  }
+  end_node_->next = head_;
+  end_node_->prev = tail_;
 }
 
 ////////////////////////////////// iterator //////////////////////////////////
-template <class T>
-typename list<T>::iterator list<T>::begin() const {
-  list<T>::iterator itr = iterator();
+template <class T, class Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() const {
+  list<T, Allocator>::iterator itr = iterator();
   itr = head_ ? *head_ : *end_node_;
   return itr;
 }
 
-template <class T>
-typename list<T>::iterator list<T>::end() const {
-  list<T>::iterator iterator;
+template <class T, class Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() const {
+  list<T, Allocator>::iterator iterator;
   if (end_node_) {
     iterator = *end_node_;
   }
@@ -395,24 +644,24 @@ typename list<T>::iterator list<T>::end() const {
 }
 
 ////////////////////////////////// Capacity //////////////////////////////////
-template <class T>
-bool list<T>::empty() const {
+template <class T, class Allocator>
+bool list<T, Allocator>::empty() const {
   return !size_;
 }
 
-template <class T>
-typename list<T>::size_type list<T>::size() const {
+template <class T, class Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::size() const {
   return size_;
 }
 
-template <class T>
-typename list<T>::size_type list<T>::max_size() const {
+template <class T, class Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max() / sizeof(node);
 }
 
 ////////////////////////////////// Access //////////////////////////////////
-template <class T>
-typename list<T>::const_reference list<T>::front() {
+template <class T, class Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() {
   static const T default_value = T{};
   if (head_) {
     return head_->value;
@@ -421,8 +670,8 @@ typename list<T>::const_reference list<T>::front() {
   }
 }
 
-template <class T>
-typename list<T>::const_reference list<T>::back() {
+template <class T, class Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() {
   static const T default_value = T{};
   if (tail_) {
     return tail_->value;
@@ -434,58 +683,64 @@ typename list<T>::const_reference list<T>::back() {
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-typename list<T>::ListIterator& list<T>::ListIterator::operator=(node& other) {
+template <class T, class Allocator>
+typename list<T, Allocator>::ListIterator&
+list<T, Allocator>::ListIterator::operator=(node& other) {
   node_ = &other;
   return *this;
 }
 
-template <class T>
-typename list<T>::value_type list<T>::iterator::operator*() {
+template <class T, class Allocator>
+typename list<T, Allocator>::value_type
+list<T, Allocator>::iterator::operator*() {
   return node_->value;
 }
 
-template <class T>
-typename list<T>::ListIterator list<T>::iterator::operator++() {
+template <class T, class Allocator>
+typename list<T, Allocator>::ListIterator
+list<T, Allocator>::iterator::operator++() {
   if (node_) {
     node_ = node_->next;
   }
   return *this;
 }
 
-template <class T>
-void list<T>::ListIterator::operator++(int) {
+template <class T, class Allocator>
+void list<T, Allocator>::ListIterator::operator++(int) {
   ++(*this);
 }
 
-template <class T>
-typename list<T>::ListIterator list<T>::iterator::operator--() {
+template <class T, class Allocator>
+typename list<T, Allocator>::ListIterator
+list<T, Allocator>::iterator::operator--() {
   if (node_ && node_->prev) {
     node_ = node_->prev;
   }
   return *this;
 }
 
-template <class T>
-void list<T>::ListIterator::operator--(int) {
+template <class T, class Allocator>
+void list<T, Allocator>::ListIterator::operator--(int) {
   --(*this);
 }
 
-template <class T>
-bool list<T>::iterator::operator==(const list<T>::ListIterator iterator) const {
+template <class T, class Allocator>
+bool list<T, Allocator>::iterator::operator==(
+    const list<T, Allocator>::ListIterator iterator) const {
   return node_ == iterator.node_;
 }
 
-template <class T>
-bool list<T>::iterator::operator!=(const list<T>::ListIterator iterator) const {
+template <class T, class Allocator>
+bool list<T, Allocator>::iterator::operator!=(
+    const list<T, Allocator>::ListIterator iterator) const {
   return node_ != iterator.node_;
 }
 
 /////////////////////////////// Modifiers DOP ///////////////////////////////
-template <class T>
+template <class T, class Allocator>
 template <typename... Args>
-typename list<T>::ListIterator list<T>::insert_many(iterator pos,
-                                                    Args&&... args) {
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert_many(
+    iterator pos, Args&&... args) {
   iterator itr = pos;
   for (auto arg : {args...}) {
     insert(itr, arg);
@@ -493,17 +748,17 @@ typename list<T>::ListIterator list<T>::insert_many(iterator pos,
   return itr;  //--irt
 }
 
-template <class T>
+template <class T, class Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
+void list<T, Allocator>::insert_many_back(Args&&... args) {
   for (auto arg : {args...}) {
     push_back(arg);
   }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
+void list<T, Allocator>::insert_many_front(Args&&... args) {
   for (auto arg : {args...}) {
     push_front(arg);
   }
@@ -1,5 +1,8 @@
+#include <algorithm>
 #include <list>
+#include <utility>
 
+#include "../allocator/s21_allocator.h"
 #include "gtest/gtest.h"
 #include "s21_list.h"
 
@@ -46,6 +49,22 @@ TEST(ListTest, FrontTestGood5) {
   EXPECT_EQ(test_list.front(), int{10});
 }
 
+TEST(ListTest, RefillAfterEmptying) {
+  s21::list<int> test_list({1, 2});
+  test_list.pop_front();
+  test_list.pop_front();
+  test_list.push_back(3);
+  test_list.push_back(4);
+  EXPECT_EQ(test_list.front(), 3);
+  test_list.pop_back();
+  test_list.pop_back();
+  test_list.push_back(5);
+  EXPECT_EQ(test_list.front(), 5);
+  EXPECT_EQ(test_list.back(), 5);
+  EXPECT_EQ(*test_list.begin(), 5);
+  EXPECT_EQ(test_list.size(), 1u);
+}
+
 TEST(default_constructor_suite, int_true_test) {
   s21::list<int> s21_a;
   std::list<int> std_a;
@@ -574,6 +593,195 @@ TEST(empty_suit, spliced_test) {
   EXPECT_TRUE(list_b.empty() == std_list_b.empty());
 }
 
+namespace {
+
+template <class T, class Allocator>
+std::list<T> to_std(const s21::list<T, Allocator> &l) {
+  std::list<T> out;
+  for (auto itr = l.begin(); itr != l.end(); ++itr) out.push_back(*itr);
+  return out;
+}
+
+// Walks back from end() to check the prev links and the tail.
+template <class T>
+std::list<T> to_std_backwards(const s21::list<T> &l) {
+  std::list<T> out;
+  if (l.empty()) return out;
+  auto itr = l.end();
+  for (std::size_t i = 0; i < l.size(); ++i) {
+    --itr;
+    out.push_front(*itr);
+  }
+  EXPECT_TRUE(itr == l.begin());
+  return out;
+}
+
+}  // namespace
+
+TEST(splice_suite, whole_list_test) {
+  s21::list<int> a({1, 2, 5});
+  s21::list<int> b({3, 4});
+  auto pos = a.begin();
+  ++pos;
+  ++pos;
+  a.splice(pos, b);
+  EXPECT_EQ(to_std(a), std::list<int>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(5));
+  EXPECT_TRUE(b.empty());
+  b.push_back(9);
+  a.splice(a.end(), b);
+  a.splice(a.begin(), b);
+  EXPECT_EQ(a.back(), 9);
+  EXPECT_EQ(a.front(), 1);
+}
+
+TEST(splice_suite, single_element_test) {
+  s21::list<int> a({1, 2, 3});
+  s21::list<int> b({10, 20, 30});
+  auto it = b.begin();
+  ++it;
+  a.splice(a.begin(), b, it);
+  EXPECT_EQ(to_std(a), std::list<int>({20, 1, 2, 3}));
+  EXPECT_EQ(to_std_backwards(b), std::list<int>({10, 30}));
+  EXPECT_EQ(b.size(), static_cast<size_t>(2));
+
+  // Within one list: move the last element to the front.
+  auto last = a.end();
+  --last;
+  a.splice(a.begin(), a, last);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({3, 20, 1, 2}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(4));
+  a.push_back(4);
+  EXPECT_EQ(a.back(), 4);
+}
+
+TEST(splice_suite, range_test) {
+  s21::list<int> a({1, 5});
+  s21::list<int> b({0, 2, 3, 4, 6});
+  auto first = b.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+  auto pos = a.begin();
+  ++pos;
+  a.splice(pos, b, first, last);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(to_std_backwards(b), std::list<int>({0, 6}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(5));
+  EXPECT_EQ(b.size(), static_cast<size_t>(2));
+
+  a.splice(a.end(), b, b.begin(), b.end());
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({1, 2, 3, 4, 5, 0, 6}));
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(splice_suite, after_reverse_test) {
+  s21::list<int> a({1, 2, 3});
+  s21::list<int> b({4, 5});
+  a.reverse();
+  a.splice(a.begin(), b);
+  EXPECT_EQ(to_std(a), std::list<int>({4, 5, 3, 2, 1}));
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({4, 5, 3, 2, 1}));
+  a.reverse();
+  auto last = a.end();
+  --last;
+  a.splice(a.begin(), a, last);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({4, 1, 2, 3, 5}));
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(merge_suite, after_reverse_test) {
+  s21::list<int> a({7, 5, 3, 1});
+  s21::list<int> b({0, 2, 4, 8});
+  a.reverse();
+  a.merge(b);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({0, 1, 2, 3, 4, 5, 7, 8}));
+  EXPECT_TRUE(b.empty());
+  b.push_back(6);
+  b.reverse();
+  a.merge(b);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+  a.reverse();
+  a.push_front(9);
+  EXPECT_EQ(to_std(a), std::list<int>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST(merge_suite, sorted_and_stable_test) {
+  s21::list<int> a({1, 3, 5, 7});
+  s21::list<int> b({2, 3, 6, 8, 9});
+  a.merge(b);
+  EXPECT_EQ(to_std_backwards(a), std::list<int>({1, 2, 3, 3, 5, 6, 7, 8, 9}));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), static_cast<size_t>(9));
+
+  using item = std::pair<int, char>;
+  auto by_key = [](const item &x, const item &y) { return x.first > y.first; };
+  s21::list<item> c({{5, 'a'}, {3, 'a'}, {1, 'a'}});
+  s21::list<item> d({{5, 'b'}, {4, 'b'}, {1, 'b'}, {0, 'b'}});
+  c.merge(d, by_key);
+  std::list<item> expected = {{5, 'a'}, {5, 'b'}, {4, 'b'}, {3, 'a'},
+                              {1, 'a'}, {1, 'b'}, {0, 'b'}};
+  EXPECT_EQ(to_std_backwards(c), expected);
+  c.push_back({-1, 'c'});
+  EXPECT_EQ(c.back().first, -1);
+}
+
+TEST(erase_suite, last_element_test) {
+  s21::list<int> list({1, 2, 3});
+  auto last = list.end();
+  --last;
+  list.erase(last);
+  EXPECT_EQ(list.back(), 2);
+  list.push_back(4);
+  EXPECT_EQ(to_std_backwards(list), std::list<int>({1, 2, 4}));
+  list.erase(list.begin());
+  list.erase(list.begin());
+  list.erase(list.begin());
+  EXPECT_TRUE(list.empty());
+  list.push_front(7);
+  list.push_back(8);
+  EXPECT_EQ(to_std_backwards(list), std::list<int>({7, 8}));
+}
+
+TEST(allocator_suite, pool_backed_list_test) {
+  using pooled = s21::list<int, s21::pool_allocator<int>>;
+  pooled a({3, 1, 2});
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 1000; ++i) a.push_back(i);
+    for (int i = 0; i < 1000; ++i) a.pop_front();
+  }
+  EXPECT_EQ(to_std(a), std::list<int>({997, 998, 999}));
+  auto pool = a.get_allocator().pool();
+  size_t slabs = pool->slabs();
+  for (int i = 0; i < 1000; ++i) a.push_front(i);
+  a.clear();
+  for (int i = 0; i < 1000; ++i) a.push_back(i);
+  EXPECT_EQ(pool->slabs(), slabs);
+
+  // Lists built from one allocator share its pool and can splice.
+  pooled b(a.get_allocator());
+  b.push_back(-1);
+  a.splice(a.begin(), b);
+  EXPECT_EQ(a.front(), -1);
+  pooled c(a);
+  EXPECT_TRUE(c.get_allocator() == a.get_allocator());
+  EXPECT_EQ(c.size(), a.size());
+
+  // Copy assignment propagates the pool; a move keeps it.
+  pooled d({4, 5});
+  EXPECT_FALSE(d.get_allocator() == a.get_allocator());
+  d = a;
+  EXPECT_TRUE(d.get_allocator() == a.get_allocator());
+  EXPECT_EQ(to_std(d), to_std(a));
+  pooled e(std::move(d));
+  EXPECT_TRUE(e.get_allocator() == a.get_allocator());
+  EXPECT_EQ(e.size(), a.size());
+}
+
 TEST(size_suite, true_test) {
   s21::list<int> list({1, 2, 3, 4, 5});
   std::list<int> std_list({1, 2, 3, 4, 5});
@@ -874,6 +1082,53 @@ TEST(sort_suite, empty_test) {
   }
 }
 
+TEST(sort_suite, large_random_test) {
+  s21::list<int> list;
+  std::list<int> std_list;
+  unsigned seed = 1;
+  for (int i = 0; i < 100000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int value = static_cast<int>(seed >> 16) % 1000;
+    list.push_back(value);
+    std_list.push_back(value);
+  }
+  list.sort();
+  std_list.sort();
+  EXPECT_EQ(list.size(), std_list.size());
+  EXPECT_TRUE(std::equal(std_list.begin(), std_list.end(), list.begin()));
+
+  // Links are whole again: both ends and the sentinel still work.
+  list.push_back(2000);
+  list.push_front(-1);
+  EXPECT_EQ(list.front(), -1);
+  EXPECT_EQ(list.back(), 2000);
+  auto last = list.end();
+  --last;
+  EXPECT_EQ(*last, 2000);
+}
+
+TEST(sort_suite, stable_with_comparator_test) {
+  struct item {
+    int key;
+    int order;
+  };
+  s21::list<item> list;
+  for (int i = 0; i < 50; ++i) list.push_back({(i * 7) % 5, i});
+  list.sort([](const item &a, const item &b) { return a.key > b.key; });
+  auto itr = list.begin();
+  item previous = *itr;
+  for (++itr; itr != list.end(); ++itr) {
+    item current = *itr;
+    EXPECT_GE(previous.key, current.key);
+    if (previous.key == current.key) {
+      EXPECT_LT(previous.order, current.order);
+    }
+    previous = current;
+  }
+  EXPECT_EQ(list.front().key, 4);
+  EXPECT_EQ(list.back().key, 0);
+}
+
 TEST(overloading_assignment_and_dereference_iterator_suite,
      overloading_true_test) {
   s21::list<int> s21_a({1, 2, 3, 4, 5});
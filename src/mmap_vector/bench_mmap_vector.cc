@@ -0,0 +1,138 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../bench/s21_bench.h"
+#include "../vector/s21_vector.h"
+#include "s21_mmap_vector.h"
+
+namespace {
+
+const int kReps = 3;
+const std::size_t kRecords = 16 * 1024 * 1024;
+const std::size_t kProbes = 1000;
+
+struct record {
+  std::uint64_t id;
+  double value;
+};
+
+using mapped = s21::mmap_vector<record>;
+
+const std::string kVectorFile = "/tmp/s21_bench_mmap_vector.bin";
+const std::string kDumpFile = "/tmp/s21_bench_dump.bin";
+
+// Drops the file's pages from the page cache so the next open starts cold.
+void evict(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return;
+  fdatasync(fd);
+#ifdef POSIX_FADV_DONTNEED
+  posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+  close(fd);
+}
+
+void write_files() {
+  unlink(kVectorFile.c_str());
+  s21::mmap_vector<record> v(kVectorFile);
+  v.reserve(kRecords);
+  for (std::size_t i = 0; i < kRecords; ++i) {
+    v.push_back(record{i, static_cast<double>(i) * 0.5});
+  }
+  v.sync();
+
+  // The same records as a plain size-prefixed dump, as a loader that
+  // deserializes into s21::vector would read them.
+  FILE *f = std::fopen(kDumpFile.c_str(), "wb");
+  std::uint64_t n = kRecords;
+  std::fwrite(&n, sizeof(n), 1, f);
+  std::fwrite(v.data(), sizeof(record), kRecords, f);
+  std::fclose(f);
+}
+
+s21::vector<record> load_dump() {
+  FILE *f = std::fopen(kDumpFile.c_str(), "rb");
+  std::uint64_t n = 0;
+  s21::vector<record> v;
+  if (std::fread(&n, sizeof(n), 1, f) == 1) {
+    v.resize_default_init(n);
+    n = std::fread(v.data(), sizeof(record), n, f);
+  }
+  std::fclose(f);
+  v.resize(n);
+  return v;
+}
+
+// Touches kProbes records spread over the vector, as a startup check would.
+template <class Vector>
+double probe(Vector &v) {
+  double total = 0;
+  std::size_t step = v.size() / kProbes;
+  for (std::size_t i = 0; i < v.size(); i += step) total += v[i].value;
+  return total;
+}
+
+template <class Vector>
+double scan(Vector &v) {
+  double total = 0;
+  for (std::size_t i = 0; i < v.size(); ++i) total += v[i].value;
+  return total;
+}
+
+template <class Fn>
+double cold(const std::string &path, Fn fn) {
+  double best = 0;
+  for (int r = 0; r < kReps; ++r) {
+    evict(path);
+    double ns = s21::bench::measure(1, fn);
+    if (r == 0 || ns < best) best = ns;
+  }
+  return best;
+}
+
+}  // namespace
+
+int main() {
+  write_files();
+  std::printf("%zu records, %zu MiB, page cache evicted before each run\n",
+              kRecords, kRecords * sizeof(record) >> 20);
+
+  s21::bench::report("s21::vector load dump", kRecords,
+                     cold(kDumpFile, [] {
+                       s21::vector<record> v = load_dump();
+                       s21::bench::do_not_optimize(v.data());
+                     }));
+  s21::bench::report("s21::vector load dump + probe", kRecords,
+                     cold(kDumpFile, [] {
+                       s21::vector<record> v = load_dump();
+                       s21::bench::do_not_optimize(probe(v));
+                     }));
+  s21::bench::report("s21::mmap_vector open", kRecords,
+                     cold(kVectorFile, [] {
+                       mapped v(kVectorFile, mapped::mode::read_only);
+                       s21::bench::do_not_optimize(v.size());
+                     }));
+  s21::bench::report("s21::mmap_vector open + probe", kRecords,
+                     cold(kVectorFile, [] {
+                       mapped v(kVectorFile, mapped::mode::read_only);
+                       s21::bench::do_not_optimize(probe(v));
+                     }));
+  s21::bench::report("s21::mmap_vector open + full scan", kRecords,
+                     cold(kVectorFile, [] {
+                       mapped v(kVectorFile, mapped::mode::read_only);
+                       s21::bench::do_not_optimize(scan(v));
+                     }));
+  s21::bench::report("s21::mmap_vector sync (clean)", kRecords,
+                     s21::bench::measure(kReps, [] {
+                       mapped v(kVectorFile);
+                       v.sync();
+                     }));
+
+  unlink(kVectorFile.c_str());
+  unlink(kDumpFile.c_str());
+  return 0;
+}
@@ -0,0 +1,528 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_MMAP_VECTOR_H
+#define CPP2_S21_CONTAINERS_1_S21_MMAP_VECTOR_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define S21_HAS_MMAP 1
+#endif
+
+#ifdef S21_HAS_MMAP
+
+namespace s21 {
+
+// A vector of trivially copyable T whose storage is a file mapped with
+// MAP_SHARED. Opening an existing file maps it instead of reading it, so a
+// multi-gigabyte vector is usable at once and pages come in on first touch.
+// Growth extends the file with ftruncate and the mapping with mremap (a new
+// mapping where mremap is unavailable). sync() flushes to disk with msync;
+// without it the kernel writes pages back on its own schedule. Opened
+// read_only, several processes share the same physical pages; modifiers
+// throw std::logic_error and writes through element references fault. A
+// reader sees at most the capacity it mapped, even after a writer grows the
+// file; refresh() maps the rest.
+//
+// File layout: a 64-byte header (magic, element size, size) followed by
+// capacity() elements.
+template <class T>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector stores raw bytes; T must be trivially copyable");
+  static_assert(alignof(T) <= 64, "mmap_vector aligns elements to 64 bytes");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  enum class mode { read_write, read_only };
+
+  //  Member functions
+  // Opens path, creating an empty vector file if it does not exist in
+  // read_write mode. Throws std::system_error on I/O failure and
+  // std::runtime_error if the file is not an mmap_vector of T.
+  explicit mmap_vector(const std::string &path, mode m = mode::read_write);
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector(mmap_vector &&v) noexcept;
+  ~mmap_vector();
+
+  mmap_vector &operator=(const mmap_vector &) = delete;
+  mmap_vector &operator=(mmap_vector &&v) noexcept;
+
+  //  Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  T *data();
+  const T *data() const;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+
+  //  Modifiers
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(mmap_vector &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  //  File
+  // Flushes the mapped pages and the header to disk before returning.
+  void sync();
+  // Extends the mapping to the file's current length, so a reader sees the
+  // elements a writer has appended since the vector was opened.
+  void refresh();
+  bool read_only() const;
+
+ private:
+  struct header {
+    char magic[8];
+    std::uint64_t element_size;
+    std::uint64_t size;
+    char reserved[40];
+  };
+  static_assert(sizeof(header) == 64, "header must keep elements aligned");
+
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '1'};
+
+  int fd_ = -1;
+  bool read_only_ = false;
+  void *map_ = nullptr;
+  size_type map_length_ = 0;
+  size_type capacity_ = 0;
+
+  header *head() const;
+  T *elements() const;
+  void set_size(size_type size);
+  void check_writable() const;
+  size_type next_capacity(size_type min_capacity) const;
+  void remap(size_type new_capacity);
+  void map_capacity(size_type new_capacity);
+  void release() noexcept;
+  [[noreturn]] static void fail(const char *what);
+};
+
+// CONSTRUCTOR
+
+template <class T>
+mmap_vector<T>::mmap_vector(const std::string &path, mode m)
+    : read_only_(m == mode::read_only) {
+  fd_ = ::open(path.c_str(), read_only_ ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+  if (fd_ < 0) fail("open");
+  try {
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) fail("fstat");
+    size_type file_size = static_cast<size_type>(st.st_size);
+    if (file_size == 0 && !read_only_) {
+      header fresh{};
+      std::memcpy(fresh.magic, kMagic, sizeof(kMagic));
+      fresh.element_size = sizeof(T);
+      if (::pwrite(fd_, &fresh, sizeof(fresh), 0) !=
+          static_cast<ssize_t>(sizeof(fresh))) {
+        fail("pwrite");
+      }
+      file_size = sizeof(header);
+    }
+    header stored{};
+    if (file_size < sizeof(header) ||
+        ::pread(fd_, &stored, sizeof(stored), 0) !=
+            static_cast<ssize_t>(sizeof(stored)) ||
+        std::memcmp(stored.magic, kMagic, sizeof(kMagic)) != 0 ||
+        stored.element_size != sizeof(T) ||
+        stored.size > (file_size - sizeof(header)) / sizeof(T)) {
+      throw std::runtime_error("not an mmap_vector file of this type: " +
+                               path);
+    }
+    capacity_ = (file_size - sizeof(header)) / sizeof(T);
+    map_length_ = sizeof(header) + capacity_ * sizeof(T);
+    map_ = ::mmap(nullptr, map_length_,
+                  read_only_ ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED,
+                  fd_, 0);
+    if (map_ == MAP_FAILED) {
+      map_ = nullptr;
+      fail("mmap");
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <class T>
+mmap_vector<T>::mmap_vector(mmap_vector &&v) noexcept
+    : fd_(std::exchange(v.fd_, -1)),
+      read_only_(v.read_only_),
+      map_(std::exchange(v.map_, nullptr)),
+      map_length_(std::exchange(v.map_length_, 0)),
+      capacity_(std::exchange(v.capacity_, 0)) {}
+
+template <class T>
+mmap_vector<T>::~mmap_vector() {
+  release();
+}
+
+template <class T>
+mmap_vector<T> &mmap_vector<T>::operator=(mmap_vector &&v) noexcept {
+  if (this != &v) {
+    release();
+    swap(v);
+  }
+  return *this;
+}
+
+// Element access
+
+template <class T>
+typename mmap_vector<T>::reference mmap_vector<T>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("out_of_range");
+  }
+  return elements()[pos];
+}
+
+template <class T>
+typename mmap_vector<T>::reference mmap_vector<T>::operator[](size_type pos) {
+  return elements()[pos];
+}
+
+template <class T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::operator[](
+    size_type pos) const {
+  return elements()[pos];
+}
+
+template <class T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::front() const {
+  return elements()[0];
+}
+
+template <class T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::back() const {
+  return elements()[size() - 1];
+}
+
+template <class T>
+T *mmap_vector<T>::data() {
+  return elements();
+}
+
+template <class T>
+const T *mmap_vector<T>::data() const {
+  return elements();
+}
+
+// Iterators
+
+template <class T>
+typename mmap_vector<T>::iterator mmap_vector<T>::begin() {
+  return elements();
+}
+
+template <class T>
+typename mmap_vector<T>::iterator mmap_vector<T>::end() {
+  return elements() + size();
+}
+
+template <class T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::begin() const {
+  return elements();
+}
+
+template <class T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::end() const {
+  return elements() + size();
+}
+
+// Capacity
+
+template <class T>
+bool mmap_vector<T>::empty() const {
+  return size() == 0;
+}
+
+template <class T>
+typename mmap_vector<T>::size_type mmap_vector<T>::size() const {
+  // The header is shared with any writer of the file, which may have grown
+  // it past what this mapping covers.
+  return map_ ? std::min(static_cast<size_type>(head()->size), capacity_) : 0;
+}
+
+template <class T>
+typename mmap_vector<T>::size_type mmap_vector<T>::max_size() const {
+  return (std::numeric_limits<off_t>::max() - sizeof(header)) / sizeof(T);
+}
+
+template <class T>
+void mmap_vector<T>::reserve(size_type size) {
+  check_writable();
+  if (size > max_size()) {
+    throw std::length_error("length_error");
+  }
+  if (size > capacity_) {
+    remap(size);
+  }
+}
+
+template <class T>
+typename mmap_vector<T>::size_type mmap_vector<T>::capacity() const {
+  return capacity_;
+}
+
+template <class T>
+void mmap_vector<T>::shrink_to_fit() {
+  check_writable();
+  if (size() < capacity_) {
+    remap(size());
+  }
+}
+
+template <class T>
+void mmap_vector<T>::resize(size_type count) {
+  resize(count, T());
+}
+
+template <class T>
+void mmap_vector<T>::resize(size_type count, const_reference value) {
+  check_writable();
+  size_type old_size = size();
+  if (count > old_size) {
+    T copy = value;
+    if (count > capacity_) {
+      remap(next_capacity(count));
+    }
+    std::fill(elements() + old_size, elements() + count, copy);
+  }
+  set_size(count);
+}
+
+// Modifiers
+
+template <class T>
+void mmap_vector<T>::clear() {
+  check_writable();
+  set_size(0);
+}
+
+template <class T>
+typename mmap_vector<T>::iterator mmap_vector<T>::insert(
+    iterator pos, const_reference value) {
+  check_writable();
+  size_type index = pos - begin();
+  T copy = value;
+  if (size() == capacity_) {
+    remap(next_capacity(size() + 1));
+  }
+  T *at = elements() + index;
+  std::memmove(static_cast<void *>(at + 1), static_cast<const void *>(at),
+               (size() - index) * sizeof(T));
+  *at = copy;
+  set_size(size() + 1);
+  return at;
+}
+
+template <class T>
+void mmap_vector<T>::erase(iterator pos) {
+  check_writable();
+  size_type index = pos - begin();
+  T *at = elements() + index;
+  std::memmove(static_cast<void *>(at), static_cast<const void *>(at + 1),
+               (size() - index - 1) * sizeof(T));
+  set_size(size() - 1);
+}
+
+template <class T>
+void mmap_vector<T>::push_back(const_reference value) {
+  check_writable();
+  size_type n = size();
+  if (n == capacity_) {
+    // Copied first, since value may live in the mapping that remap moves.
+    T copy = value;
+    remap(next_capacity(n + 1));
+    elements()[n] = copy;
+  } else {
+    elements()[n] = value;
+  }
+  set_size(n + 1);
+}
+
+template <class T>
+void mmap_vector<T>::pop_back() {
+  check_writable();
+  set_size(size() - 1);
+}
+
+template <class T>
+void mmap_vector<T>::swap(mmap_vector &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(read_only_, other.read_only_);
+  std::swap(map_, other.map_);
+  std::swap(map_length_, other.map_length_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <class T>
+template <typename... Args>
+void mmap_vector<T>::insert_many_back(Args &&...args) {
+  check_writable();
+  if constexpr (sizeof...(args) != 0) {
+    T temp[] = {T(std::forward<Args>(args))...};
+    size_type n = size();
+    if (n + sizeof...(args) > capacity_) {
+      remap(next_capacity(n + sizeof...(args)));
+    }
+    std::memcpy(static_cast<void *>(elements() + n), temp, sizeof(temp));
+    set_size(n + sizeof...(args));
+  }
+}
+
+// File
+
+template <class T>
+void mmap_vector<T>::sync() {
+  check_writable();
+  if (::msync(map_, map_length_, MS_SYNC) != 0) fail("msync");
+}
+
+template <class T>
+void mmap_vector<T>::refresh() {
+  struct stat st;
+  if (::fstat(fd_, &st) != 0) fail("fstat");
+  size_type file_size = static_cast<size_type>(st.st_size);
+  if (file_size > sizeof(header) &&
+      (file_size - sizeof(header)) / sizeof(T) > capacity_) {
+    map_capacity((file_size - sizeof(header)) / sizeof(T));
+  }
+}
+
+template <class T>
+bool mmap_vector<T>::read_only() const {
+  return read_only_;
+}
+
+// Storage
+
+template <class T>
+typename mmap_vector<T>::header *mmap_vector<T>::head() const {
+  return static_cast<header *>(map_);
+}
+
+template <class T>
+T *mmap_vector<T>::elements() const {
+  return reinterpret_cast<T *>(static_cast<char *>(map_) + sizeof(header));
+}
+
+template <class T>
+void mmap_vector<T>::set_size(size_type size) {
+  head()->size = size;
+}
+
+template <class T>
+void mmap_vector<T>::check_writable() const {
+  if (read_only_) {
+    throw std::logic_error("mmap_vector opened read-only");
+  }
+}
+
+template <class T>
+typename mmap_vector<T>::size_type mmap_vector<T>::next_capacity(
+    size_type min_capacity) const {
+  if (min_capacity > max_size()) {
+    throw std::length_error("length_error");
+  }
+  size_type new_capacity = capacity_ ? capacity_ * 2 : 1;
+  if (new_capacity < min_capacity || new_capacity > max_size()) {
+    new_capacity = min_capacity;
+  }
+  return new_capacity;
+}
+
+// Resizes the file to hold new_capacity elements, then the mapping to
+// match. Pointers into the vector are invalidated, as with reallocation.
+template <class T>
+void mmap_vector<T>::remap(size_type new_capacity) {
+  size_type new_length = sizeof(header) + new_capacity * sizeof(T);
+  if (::ftruncate(fd_, static_cast<off_t>(new_length)) != 0) fail("ftruncate");
+  map_capacity(new_capacity);
+}
+
+// Points the mapping at the first new_capacity elements of the file, which
+// must already be that long.
+template <class T>
+void mmap_vector<T>::map_capacity(size_type new_capacity) {
+  size_type new_length = sizeof(header) + new_capacity * sizeof(T);
+#ifdef __linux__
+  void *p = ::mremap(map_, map_length_, new_length, MREMAP_MAYMOVE);
+  if (p == MAP_FAILED) fail("mremap");
+#else
+  void *p = ::mmap(nullptr, new_length,
+                   read_only_ ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED,
+                   fd_, 0);
+  if (p == MAP_FAILED) fail("mmap");
+  ::munmap(map_, map_length_);
+#endif
+  map_ = p;
+  map_length_ = new_length;
+  capacity_ = new_capacity;
+}
+
+template <class T>
+void mmap_vector<T>::release() noexcept {
+  if (map_ != nullptr) {
+    ::munmap(map_, map_length_);
+    map_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  map_length_ = 0;
+  capacity_ = 0;
+}
+
+template <class T>
+void mmap_vector<T>::fail(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace s21
+
+#endif  // S21_HAS_MMAP
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_MMAP_VECTOR_H
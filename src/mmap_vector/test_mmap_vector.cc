@@ -0,0 +1,168 @@
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "gtest/gtest.h"
+#include "s21_mmap_vector.h"
+
+namespace {
+
+struct point {
+  std::int32_t x;
+  std::int32_t y;
+  double weight;
+};
+
+// A fresh file path per test, removed again when the test ends.
+class temp_path {
+ public:
+  temp_path() {
+    char name[] = "/tmp/s21_mmap_vector_XXXXXX";
+    int fd = mkstemp(name);
+    close(fd);
+    unlink(name);
+    path_ = name;
+  }
+  ~temp_path() { unlink(path_.c_str()); }
+  const std::string &str() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(mmap_vector_suite, new_file_starts_empty) {
+  temp_path path;
+  s21::mmap_vector<int> v(path.str());
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.size(), static_cast<size_t>(0));
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(0));
+  EXPECT_FALSE(v.read_only());
+}
+
+TEST(mmap_vector_suite, contents_survive_reopen) {
+  temp_path path;
+  {
+    s21::mmap_vector<point> v(path.str());
+    for (int i = 0; i < 1000; ++i) v.push_back(point{i, -i, i * 0.5});
+    v.sync();
+  }
+  s21::mmap_vector<point> v(path.str());
+  ASSERT_EQ(v.size(), static_cast<size_t>(1000));
+  EXPECT_EQ(v[999].x, 999);
+  EXPECT_EQ(v.back().y, -999);
+  EXPECT_EQ(v.front().weight, 0.0);
+  EXPECT_GE(v.capacity(), static_cast<size_t>(1000));
+}
+
+TEST(mmap_vector_suite, growth_keeps_elements) {
+  temp_path path;
+  s21::mmap_vector<std::uint64_t> v(path.str());
+  v.reserve(10);
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(10));
+  for (std::uint64_t i = 0; i < 100000; ++i) v.push_back(i * 3);
+  for (std::uint64_t i = 0; i < 100000; i += 997) EXPECT_EQ(v[i], i * 3);
+  v.resize(5);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(5));
+  v.resize(8, 42);
+  EXPECT_EQ(v[7], static_cast<std::uint64_t>(42));
+  v.push_back(v[0]);
+  EXPECT_EQ(v.back(), static_cast<std::uint64_t>(0));
+}
+
+TEST(mmap_vector_suite, insert_erase_and_many_back) {
+  temp_path path;
+  s21::mmap_vector<int> v(path.str());
+  v.insert_many_back(1, 2, 4);
+  v.insert(v.begin() + 2, 3);
+  v.insert(v.begin(), 0);
+  v.erase(v.begin() + 4);
+  ASSERT_EQ(v.size(), static_cast<size_t>(4));
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i], i);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+  v.pop_back();
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(mmap_vector_suite, read_only_shares_and_rejects_writes) {
+  temp_path path;
+  s21::mmap_vector<int> writer(path.str());
+  writer.insert_many_back(7, 8, 9);
+  writer.sync();
+  s21::mmap_vector<int> reader(path.str(),
+                               s21::mmap_vector<int>::mode::read_only);
+  EXPECT_TRUE(reader.read_only());
+  EXPECT_EQ(reader.size(), static_cast<size_t>(3));
+  const s21::mmap_vector<int> &view = reader;
+  EXPECT_EQ(view[1], 8);
+  writer[1] = 80;
+  EXPECT_EQ(view[1], 80);
+  EXPECT_THROW(reader.push_back(1), std::logic_error);
+  EXPECT_THROW(reader.reserve(100), std::logic_error);
+}
+
+TEST(mmap_vector_suite, reader_outlives_writer_growth) {
+  temp_path path;
+  s21::mmap_vector<int> writer(path.str());
+  writer.insert_many_back(1, 2, 3);
+  s21::mmap_vector<int> reader(path.str(),
+                               s21::mmap_vector<int>::mode::read_only);
+  size_t mapped = reader.capacity();
+  for (int i = 0; i < 100000; ++i) writer.push_back(i);
+  EXPECT_EQ(reader.size(), mapped);
+  long long sum = 0;
+  for (int x : reader) sum += x;
+  EXPECT_EQ(reader.end() - reader.begin(), static_cast<std::ptrdiff_t>(mapped));
+  EXPECT_GE(sum, 6);
+
+  reader.refresh();
+  EXPECT_EQ(reader.size(), static_cast<size_t>(100003));
+  EXPECT_EQ(reader.back(), 99999);
+  sum = 0;
+  for (int x : reader) sum += x;
+  EXPECT_EQ(sum, 6 + 99999LL * 100000 / 2);
+}
+
+TEST(mmap_vector_suite, rejects_foreign_files) {
+  temp_path path;
+  {
+    s21::mmap_vector<int> v(path.str());
+    v.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<double>{path.str()}, std::runtime_error);
+  EXPECT_THROW(s21::mmap_vector<int>("/nonexistent/dir/file"),
+               std::system_error);
+  FILE *f = std::fopen(path.str().c_str(), "w");
+  std::fputs("plain text, not a vector", f);
+  std::fclose(f);
+  EXPECT_THROW(s21::mmap_vector<int>{path.str()}, std::runtime_error);
+}
+
+TEST(mmap_vector_suite, move_and_swap) {
+  temp_path a_path, b_path;
+  s21::mmap_vector<int> a(a_path.str());
+  s21::mmap_vector<int> b(b_path.str());
+  a.push_back(1);
+  b.insert_many_back(2, 3);
+  a.swap(b);
+  EXPECT_EQ(a.size(), static_cast<size_t>(2));
+  EXPECT_EQ(b[0], 1);
+  s21::mmap_vector<int> c(std::move(a));
+  EXPECT_EQ(c[1], 3);
+  EXPECT_EQ(a.size(), static_cast<size_t>(0));
+  b = std::move(c);
+  EXPECT_EQ(b.size(), static_cast<size_t>(2));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
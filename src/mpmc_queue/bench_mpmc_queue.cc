@@ -0,0 +1,90 @@
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "../bench/s21_bench.h"
+#include "../queue/s21_queue.h"
+#include "../vector/s21_vector.h"
+#include "s21_mpmc_queue.h"
+
+namespace {
+
+const int kReps = 3;
+const std::size_t kCapacity = 1024;
+
+// The baseline this replaces: s21::queue under one mutex, with condition
+// variables for the blocking calls, bounded to the same capacity.
+class locked_queue {
+ public:
+  explicit locked_queue(std::size_t capacity) : capacity_(capacity) {}
+
+  void push(std::uint64_t value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return queue_.size() < capacity_; });
+    queue_.push(value);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+  void pop(std::uint64_t &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty(); });
+    value = queue_.front();
+    queue_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+  }
+
+ private:
+  std::size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  s21::queue<std::uint64_t> queue_;
+};
+
+// threads/2 producers and threads/2 consumers move n items in total through
+// one queue with the blocking calls.
+template <class Queue>
+void contention(const char *name, std::size_t threads, std::size_t n) {
+  std::size_t pairs = threads / 2;
+  std::size_t per_thread = n / pairs;
+  double ns = s21::bench::measure(kReps, [pairs, per_thread] {
+    Queue q(kCapacity);
+    s21::vector<std::thread> workers;
+    workers.reserve(2 * pairs);
+    for (std::size_t p = 0; p < pairs; ++p) {
+      workers.push_back(std::thread([&q, per_thread] {
+        for (std::uint64_t i = 0; i < per_thread; ++i) q.push(i);
+      }));
+      workers.push_back(std::thread([&q, per_thread] {
+        std::uint64_t sum = 0, value = 0;
+        for (std::size_t i = 0; i < per_thread; ++i) {
+          q.pop(value);
+          sum += value;
+        }
+        s21::bench::do_not_optimize(sum);
+      }));
+    }
+    for (std::thread &t : workers) t.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zu threads", name, threads);
+  s21::bench::report(label, pairs * per_thread, ns);
+}
+
+}  // namespace
+
+// Usage: ./bench [max_threads]
+int main(int argc, char **argv) {
+  std::size_t max_threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+  std::size_t n = std::size_t(1) << 20;
+  for (std::size_t threads = 2; threads <= max_threads; threads *= 2) {
+    contention<locked_queue>("mutex + s21::queue", threads, n);
+    contention<s21::mpmc_queue<std::uint64_t>>("s21::mpmc_queue", threads, n);
+  }
+  return 0;
+}
@@ -0,0 +1,336 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_MPMC_QUEUE_H
+#define CPP2_S21_CONTAINERS_1_S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Bounded FIFO for any number of producer and consumer threads, after
+// Dmitry Vyukov's array queue. Each slot carries a sequence number saying
+// whose turn it is, so a push or pop costs one CAS on a shared index plus
+// plain loads and stores on its own slot; producers and consumers only meet
+// when the queue is full or empty. try_push/try_pop never block. push/pop
+// spin briefly and then sleep on a condition variable; the other side pays
+// for a wake-up only while someone is actually asleep.
+//
+// A claimed slot has to be filled (or emptied) before anyone can get past
+// it, so T must be nothrow movable: values are built first and moved in.
+template <class T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue elements must be nothrow movable");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using size_type = size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+  //  Member functions
+  // capacity is rounded up to a power of two, at least 2.
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue();
+
+  //  Capacity
+  bool empty() const;
+  // A snapshot; other threads may change it before it is returned.
+  size_type size() const;
+  size_type capacity() const;
+
+  //  Non-blocking. Return false when full (or empty).
+  bool try_push(const T &value);
+  bool try_push(T &&value);
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(T &value);
+
+  //  Blocking
+  void push(const T &value);
+  void push(T &&value);
+  void pop(T &value);
+  // Appends all args as one contiguous run where there is room for them,
+  // blocking for space as needed. Elements from one call keep their order.
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  struct cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+
+  static constexpr int kSpins = 64;
+
+  cell &at(size_type pos) { return cells_[pos & mask_]; }
+  size_type claim_push(size_type wanted, size_type &pos);
+  bool pop_slot(T &value);
+  void wake_consumers(size_type published);
+  void wake_producers();
+  template <class Ready>
+  void park(std::condition_variable &cv, std::atomic<size_type> &waiters,
+            Ready ready);
+
+  const size_type mask_;
+  std::unique_ptr<cell[]> cells_;
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> push_waiters_{0};
+  std::atomic<size_type> pop_waiters_{0};
+  std::mutex park_mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+// CONSTRUCTOR
+
+template <class T>
+mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : mask_([capacity] {
+        size_type n = 2;
+        while (n < capacity) n *= 2;
+        return n - 1;
+      }()),
+      cells_(new cell[mask_ + 1]) {
+  for (size_type i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <class T>
+mpmc_queue<T>::~mpmc_queue() {
+  size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != tail; ++pos) {
+    at(pos).value()->~T();
+  }
+}
+
+// Capacity
+
+template <class T>
+bool mpmc_queue<T>::empty() const {
+  return size() == 0;
+}
+
+template <class T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <class T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::capacity() const {
+  return mask_ + 1;
+}
+
+// Non-blocking
+
+template <class T>
+bool mpmc_queue<T>::try_push(const T &value) {
+  return try_emplace(value);
+}
+
+template <class T>
+bool mpmc_queue<T>::try_push(T &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <class T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args &&...args) {
+  if constexpr (std::is_nothrow_constructible_v<T, Args &&...>) {
+    size_type pos;
+    if (claim_push(1, pos) == 0) return false;
+    cell &c = at(pos);
+    ::new (static_cast<void *>(c.storage)) T(std::forward<Args>(args)...);
+    c.sequence.store(pos + 1, std::memory_order_release);
+    wake_consumers(1);
+    return true;
+  } else {
+    return try_emplace(T(std::forward<Args>(args)...));
+  }
+}
+
+template <class T>
+bool mpmc_queue<T>::try_pop(T &value) {
+  if (!pop_slot(value)) return false;
+  wake_producers();
+  return true;
+}
+
+// Blocking
+
+template <class T>
+void mpmc_queue<T>::push(const T &value) {
+  push(T(value));
+}
+
+template <class T>
+void mpmc_queue<T>::push(T &&value) {
+  size_type pos;
+  if (claim_push(1, pos) == 0) {
+    park(not_full_, push_waiters_,
+         [this, &pos] { return claim_push(1, pos) != 0; });
+  }
+  cell &c = at(pos);
+  ::new (static_cast<void *>(c.storage)) T(std::move(value));
+  c.sequence.store(pos + 1, std::memory_order_release);
+  wake_consumers(1);
+}
+
+template <class T>
+void mpmc_queue<T>::pop(T &value) {
+  if (!pop_slot(value)) {
+    park(not_empty_, pop_waiters_, [this, &value] { return pop_slot(value); });
+  }
+  wake_producers();
+}
+
+template <class T>
+template <typename... Args>
+void mpmc_queue<T>::insert_many_back(Args &&...args) {
+  if constexpr (sizeof...(args) != 0) {
+    T temp[] = {T(std::forward<Args>(args))...};
+    const size_type total = sizeof...(args);
+    for (size_type done = 0; done < total;) {
+      size_type pos;
+      size_type count = claim_push(total - done, pos);
+      if (count == 0) {
+        park(not_full_, push_waiters_, [this, &pos, &count, done, total] {
+          count = claim_push(total - done, pos);
+          return count != 0;
+        });
+      }
+      for (size_type i = 0; i < count; ++i) {
+        cell &c = at(pos + i);
+        ::new (static_cast<void *>(c.storage)) T(std::move(temp[done + i]));
+        c.sequence.store(pos + i + 1, std::memory_order_release);
+      }
+      done += count;
+      wake_consumers(count);
+    }
+  }
+}
+
+// Slots
+
+// Claims up to wanted consecutive slots starting at the tail and returns how
+// many, 0 if the queue is full. A slot is free for position p when its
+// sequence equals p; once the CAS moves the tail past the run, no other
+// producer can reach those slots, so the check before it cannot go stale.
+template <class T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::claim_push(size_type wanted,
+                                                           size_type &pos) {
+  pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    size_type count = 0;
+    std::intptr_t diff = 0;
+    while (count < wanted) {
+      size_type seq = at(pos + count).sequence.load(std::memory_order_acquire);
+      diff = static_cast<std::intptr_t>(seq) -
+             static_cast<std::intptr_t>(pos + count);
+      if (diff != 0) break;
+      ++count;
+    }
+    if (count != 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + count,
+                                             std::memory_order_relaxed)) {
+        return count;
+      }
+    } else if (diff < 0) {
+      return 0;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Takes the head element if one is published. The slot is handed back to
+// producers one lap later by bumping its sequence past this round.
+template <class T>
+bool mpmc_queue<T>::pop_slot(T &value) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  cell *c;
+  for (;;) {
+    c = &at(pos);
+    size_type seq = c->sequence.load(std::memory_order_acquire);
+    std::intptr_t diff = static_cast<std::intptr_t>(seq) -
+                         static_cast<std::intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  T *p = c->value();
+  value = std::move(*p);
+  p->~T();
+  c->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+// Parking
+
+// The fences pair with the one in park(): either the sleeper sees the new
+// element (or free slot) when it rechecks, or this side sees the sleeper
+// counted and wakes it. Taking the mutex orders the notify after the
+// sleeper's last check.
+template <class T>
+void mpmc_queue<T>::wake_consumers(size_type published) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (pop_waiters_.load(std::memory_order_relaxed) == 0) return;
+  { std::lock_guard<std::mutex> lock(park_mutex_); }
+  if (published == 1) {
+    not_empty_.notify_one();
+  } else {
+    not_empty_.notify_all();
+  }
+}
+
+template <class T>
+void mpmc_queue<T>::wake_producers() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (push_waiters_.load(std::memory_order_relaxed) == 0) return;
+  { std::lock_guard<std::mutex> lock(park_mutex_); }
+  not_full_.notify_one();
+}
+
+template <class T>
+template <class Ready>
+void mpmc_queue<T>::park(std::condition_variable &cv,
+                         std::atomic<size_type> &waiters, Ready ready) {
+  for (int i = 0; i < kSpins; ++i) {
+    std::this_thread::yield();
+    if (ready()) return;
+  }
+  std::unique_lock<std::mutex> lock(park_mutex_);
+  waiters.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  cv.wait(lock, ready);
+  waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_MPMC_QUEUE_H
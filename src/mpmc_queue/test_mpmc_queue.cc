@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test/s21_test.h"
+#include "gtest/gtest.h"
+#include "s21_mpmc_queue.h"
+
+using s21::test::tracked;
+
+TEST(mpmc_queue_suite, capacity_rounds_up) {
+  EXPECT_EQ(s21::mpmc_queue<int>(0).capacity(), static_cast<size_t>(2));
+  EXPECT_EQ(s21::mpmc_queue<int>(5).capacity(), static_cast<size_t>(8));
+  EXPECT_EQ(s21::mpmc_queue<int>(64).capacity(), static_cast<size_t>(64));
+}
+
+TEST(mpmc_queue_suite, fifo_full_and_empty) {
+  s21::mpmc_queue<std::string> q(4);
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(std::to_string(i)));
+  EXPECT_FALSE(q.try_push("4"));
+  EXPECT_TRUE(q.try_emplace(1, 'x') == false);
+  EXPECT_EQ(q.size(), static_cast<size_t>(4));
+  std::string value;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, std::to_string(i));
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(mpmc_queue_suite, wraps_around) {
+  s21::mpmc_queue<int> q(8);
+  int value = 0;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(q.try_push(i));
+    if (i >= 5) {
+      ASSERT_TRUE(q.try_pop(value));
+      EXPECT_EQ(value, i - 5);
+    }
+  }
+  EXPECT_EQ(q.size(), static_cast<size_t>(5));
+}
+
+TEST(mpmc_queue_suite, insert_many_back_keeps_order) {
+  s21::mpmc_queue<int> q(4);
+  q.push(0);
+  std::thread consumer([&q] {
+    // Six elements cannot fit at once; the batch waits for this drain.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    int value;
+    for (int i = 0; i < 4; ++i) q.pop(value);
+  });
+  q.insert_many_back(1, 2, 3, 4, 5, 6);
+  consumer.join();
+  std::vector<int> rest;
+  int value;
+  while (q.try_pop(value)) rest.push_back(value);
+  EXPECT_EQ(rest, (std::vector<int>{4, 5, 6}));
+}
+
+TEST(mpmc_queue_suite, blocking_push_and_pop) {
+  s21::mpmc_queue<std::unique_ptr<int>> q(2);
+  const int n = 10000;
+  std::thread producer([&q] {
+    for (int i = 0; i < n; ++i) q.push(std::make_unique<int>(i));
+  });
+  bool ordered = true;
+  std::unique_ptr<int> p;
+  for (int i = 0; i < n; ++i) {
+    q.pop(p);
+    ordered &= *p == i;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(mpmc_queue_suite, many_producers_many_consumers) {
+  const int producers = 4, consumers = 4, per_producer = 20000;
+  s21::mpmc_queue<std::uint64_t> q(64);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (std::uint64_t i = 0; i < per_producer; ++i) {
+        std::uint64_t tagged = (std::uint64_t(p) << 32) | i;
+        if (i % 2) {
+          q.push(tagged);
+        } else {
+          while (!q.try_push(tagged)) std::this_thread::yield();
+        }
+      }
+    });
+  }
+  std::atomic<std::uint64_t> sum{0};
+  std::atomic<bool> ordered{true};
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      // Values from one producer must reach any one consumer in order.
+      std::vector<std::int64_t> last(producers, -1);
+      std::uint64_t local = 0;
+      for (int i = 0; i < producers * per_producer / consumers; ++i) {
+        std::uint64_t v;
+        q.pop(v);
+        std::int64_t seq = static_cast<std::int64_t>(v & 0xffffffff);
+        std::int64_t &prev = last[v >> 32];
+        if (seq <= prev) ordered = false;
+        prev = seq;
+        local += v & 0xffffffff;
+      }
+      sum += local;
+    });
+  }
+  for (std::thread &t : threads) t.join();
+  std::uint64_t expected =
+      std::uint64_t(producers) * per_producer * (per_producer - 1) / 2;
+  EXPECT_EQ(sum.load(), expected);
+  EXPECT_TRUE(ordered.load());
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(mpmc_queue_suite, destroys_what_is_left) {
+  {
+    s21::mpmc_queue<tracked> q(8);
+    q.try_emplace(1);
+    q.insert_many_back(tracked(2), tracked(3));
+    tracked out;
+    q.try_pop(out);
+    EXPECT_EQ(out.value, 1);
+    EXPECT_EQ(tracked::live, 3);
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+
+#include "../bench/s21_bench.h"
+#include "../vector/s21_vector.h"
+#include "s21_parallel.h"
+
+namespace {
+
+const int kReps = 3;
+const std::size_t kElements = 16 * 1024 * 1024;
+const std::size_t kSortElements = 4 * 1024 * 1024;
+
+s21::vector<double> random_values(std::size_t n) {
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  s21::vector<double> v(n);
+  for (std::size_t i = 0; i < n; ++i) v[i] = dist(gen);
+  return v;
+}
+
+void report(const char *name, std::size_t threads, std::size_t n, double ns) {
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s threads=%zu", name, threads);
+  s21::bench::report(label, n, ns);
+}
+
+// Sequential std:: baselines that the parallel rows are compared against.
+void run_sequential(s21::vector<double> &input) {
+  s21::vector<double> v = input;
+  s21::vector<double> out(v.size());
+  report("std::for_each", 1, v.size(), s21::bench::measure(kReps, [&] {
+           std::for_each(v.begin(), v.end(), [](double &x) { x *= 1.0001; });
+         }));
+  report("std::transform", 1, v.size(), s21::bench::measure(kReps, [&] {
+           std::transform(v.begin(), v.end(), out.begin(),
+                          [](double x) { return std::sqrt(x); });
+         }));
+  report("std::accumulate", 1, v.size(), s21::bench::measure(kReps, [&] {
+           s21::bench::do_not_optimize(
+               std::accumulate(v.begin(), v.end(), 0.0));
+         }));
+  report("std::partial_sum", 1, v.size(), s21::bench::measure(kReps, [&] {
+           std::partial_sum(v.begin(), v.end(), out.begin());
+         }));
+  double ns = 0;
+  for (int r = 0; r < kReps; ++r) {
+    s21::vector<double> s;
+    s.append(input.begin(), input.begin() + kSortElements);
+    ns += s21::bench::measure(1, [&] { std::sort(s.begin(), s.end()); });
+  }
+  report("std::sort", 1, kSortElements, ns / kReps);
+}
+
+void run_parallel(s21::vector<double> &input, std::size_t threads) {
+  s21::thread_pool pool(threads);
+  s21::vector<double> v = input;
+  s21::vector<double> out(v.size());
+  report("parallel::for_each", threads, v.size(),
+         s21::bench::measure(kReps, [&] {
+           s21::parallel::for_each(pool, v.begin(), v.end(),
+                                   [](double &x) { x *= 1.0001; });
+         }));
+  report("parallel::transform", threads, v.size(),
+         s21::bench::measure(kReps, [&] {
+           s21::parallel::transform(pool, v.begin(), v.end(), out.begin(),
+                                    [](double x) { return std::sqrt(x); });
+         }));
+  report("parallel::reduce", threads, v.size(),
+         s21::bench::measure(kReps, [&] {
+           s21::bench::do_not_optimize(
+               s21::parallel::reduce(pool, v.begin(), v.end(), 0.0));
+         }));
+  report("parallel::inclusive_scan", threads, v.size(),
+         s21::bench::measure(kReps, [&] {
+           s21::parallel::inclusive_scan(pool, v.begin(), v.end(),
+                                         out.begin());
+         }));
+  double ns = 0;
+  for (int r = 0; r < kReps; ++r) {
+    s21::vector<double> s;
+    s.append(input.begin(), input.begin() + kSortElements);
+    ns += s21::bench::measure(
+        1, [&] { s21::parallel::sort(pool, s.begin(), s.end()); });
+  }
+  report("parallel::sort", threads, kSortElements, ns / kReps);
+}
+
+}  // namespace
+
+// ./bench [max_threads]; defaults to the hardware thread count.
+int main(int argc, char **argv) {
+  s21::vector<double> input = random_values(kElements);
+  std::size_t max_threads = s21::thread_pool::default_concurrency();
+  if (argc > 1) max_threads = std::max(std::atoi(argv[1]), 1);
+  std::printf("hardware threads: %zu\n", max_threads);
+  run_sequential(input);
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    run_parallel(input, threads);
+  }
+  if ((max_threads & (max_threads - 1)) != 0) {
+    run_parallel(input, max_threads);
+  }
+  return 0;
+}
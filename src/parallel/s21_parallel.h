@@ -0,0 +1,260 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_PARALLEL_H
+#define CPP2_S21_CONTAINERS_1_S21_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "s21_thread_pool.h"
+
+// Parallel versions of the common bulk algorithms for random-access ranges
+// (s21::vector, s21::array, raw pointers). Each one splits the range into a
+// few chunks per worker and runs them as a task_group on a thread_pool; the
+// overloads without a pool use default_pool(). Inputs shorter than
+// kMinChunk run sequentially on the calling thread.
+namespace s21 {
+namespace parallel {
+
+inline constexpr size_t kMinChunk = 4096;
+
+inline thread_pool &default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+namespace internal {
+
+// Number of chunks to cut n elements into: about four per worker so that
+// stealing can even out uneven chunks, but none smaller than kMinChunk.
+inline size_t chunk_count(thread_pool &pool, size_t n) {
+  size_t by_size = std::max<size_t>(n / kMinChunk, 1);
+  return std::min(by_size, pool.size() * 4);
+}
+
+// Calls fn(chunk, first, last) for each of `chunks` contiguous index ranges
+// covering [0, n), in parallel, and waits for all of them.
+template <class Fn>
+void for_chunks(thread_pool &pool, size_t n, size_t chunks, Fn fn) {
+  if (chunks <= 1) {
+    fn(size_t{0}, size_t{0}, n);
+    return;
+  }
+  task_group group(pool);
+  for (size_t c = 1; c < chunks; ++c) {
+    group.run([&fn, c, n, chunks] {
+      fn(c, n * c / chunks, n * (c + 1) / chunks);
+    });
+  }
+  fn(size_t{0}, size_t{0}, n / chunks);
+  group.wait();
+}
+
+// Stable merge of [first1, last1) and [first2, last2) into out, moving the
+// elements. Large merges are split around the median of the longer input so
+// that both halves can run in parallel.
+template <class It, class Out, class Compare>
+void merge(task_group &group, It first1, It last1, It first2, It last2,
+           Out out, Compare comp) {
+  while (static_cast<size_t>((last1 - first1) + (last2 - first2)) >
+         kMinChunk * 4) {
+    It mid1, mid2;
+    if (last1 - first1 >= last2 - first2) {
+      mid1 = first1 + (last1 - first1) / 2;
+      mid2 = std::lower_bound(first2, last2, *mid1, comp);
+    } else {
+      mid2 = first2 + (last2 - first2) / 2;
+      mid1 = std::upper_bound(first1, last1, *mid2, comp);
+    }
+    Out out_mid = out + (mid1 - first1) + (mid2 - first2);
+    group.run([&group, mid1, last1, mid2, last2, out_mid, comp] {
+      merge(group, mid1, last1, mid2, last2, out_mid, comp);
+    });
+    last1 = mid1;
+    last2 = mid2;
+  }
+  std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+             std::make_move_iterator(first2), std::make_move_iterator(last2),
+             out, comp);
+}
+
+}  // namespace internal
+
+// Calls fn on every element of [first, last).
+template <class RandomIt, class Fn>
+void for_each(thread_pool &pool, RandomIt first, RandomIt last, Fn fn) {
+  size_t n = static_cast<size_t>(last - first);
+  internal::for_chunks(pool, n, internal::chunk_count(pool, n),
+                       [&](size_t, size_t lo, size_t hi) {
+                         std::for_each(first + lo, first + hi, fn);
+                       });
+}
+
+// Writes op(x) for every x in [first, last) to d_first. Returns the end of
+// the output range.
+template <class RandomIt, class OutIt, class UnaryOp>
+OutIt transform(thread_pool &pool, RandomIt first, RandomIt last, OutIt d_first,
+                UnaryOp op) {
+  size_t n = static_cast<size_t>(last - first);
+  internal::for_chunks(
+      pool, n, internal::chunk_count(pool, n),
+      [&](size_t, size_t lo, size_t hi) {
+        std::transform(first + lo, first + hi, d_first + lo, op);
+      });
+  return d_first + n;
+}
+
+// Folds [first, last) into init with op, which must be associative; chunks
+// are combined left to right, so op need not be commutative.
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(thread_pool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = BinaryOp()) {
+  size_t n = static_cast<size_t>(last - first);
+  size_t chunks = internal::chunk_count(pool, n);
+  if (chunks <= 1) {
+    return std::accumulate(first, last, std::move(init), op);
+  }
+  s21::vector<T> partial(chunks);
+  internal::for_chunks(pool, n, chunks, [&](size_t c, size_t lo, size_t hi) {
+    T acc = first[lo];
+    for (size_t i = lo + 1; i < hi; ++i) acc = op(std::move(acc), first[i]);
+    partial[c] = std::move(acc);
+  });
+  for (size_t c = 0; c < chunks; ++c) {
+    init = op(std::move(init), std::move(partial[c]));
+  }
+  return init;
+}
+
+// Writes the running fold of [first, last) under op to d_first; element i of
+// the output is first[0] op ... op first[i]. op must be associative. d_first
+// may equal first. Returns the end of the output range.
+template <class RandomIt, class OutIt, class BinaryOp = std::plus<>>
+OutIt inclusive_scan(thread_pool &pool, RandomIt first, RandomIt last,
+                     OutIt d_first, BinaryOp op = BinaryOp()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t n = static_cast<size_t>(last - first);
+  size_t chunks = internal::chunk_count(pool, n);
+  if (chunks <= 1) {
+    return std::partial_sum(first, last, d_first, op);
+  }
+  // Pass 1 folds each chunk, a short sequential scan turns the chunk totals
+  // into carries, and pass 2 rescans each chunk starting from its carry.
+  s21::vector<T> carry(chunks);
+  internal::for_chunks(pool, n, chunks, [&](size_t c, size_t lo, size_t hi) {
+    if (c + 1 == chunks) return;
+    T acc = first[lo];
+    for (size_t i = lo + 1; i < hi; ++i) acc = op(std::move(acc), first[i]);
+    carry[c + 1] = std::move(acc);
+  });
+  for (size_t c = 2; c < chunks; ++c) {
+    carry[c] = op(carry[c - 1], carry[c]);
+  }
+  internal::for_chunks(pool, n, chunks, [&](size_t c, size_t lo, size_t hi) {
+    T acc = c == 0 ? T(first[lo]) : op(carry[c], first[lo]);
+    d_first[lo] = acc;
+    for (size_t i = lo + 1; i < hi; ++i) {
+      acc = op(std::move(acc), first[i]);
+      d_first[i] = acc;
+    }
+  });
+  return d_first + n;
+}
+
+// Sorts [first, last) with comp. Chunks are sorted in parallel and then
+// merged pairwise through a scratch buffer, with each merge itself split
+// across tasks. Not stable. The value type must be default constructible.
+template <class RandomIt, class Compare = std::less<>>
+void sort(thread_pool &pool, RandomIt first, RandomIt last,
+          Compare comp = Compare()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t n = static_cast<size_t>(last - first);
+  size_t chunks = std::min(internal::chunk_count(pool, n), pool.size());
+  if (chunks <= 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+  s21::vector<size_t> bounds(chunks + 1);
+  for (size_t c = 0; c <= chunks; ++c) bounds[c] = n * c / chunks;
+  internal::for_chunks(pool, n, chunks, [&](size_t c, size_t, size_t) {
+    std::sort(first + bounds[c], first + bounds[c + 1], comp);
+  });
+
+  s21::vector<T> buffer;
+  buffer.resize_default_init(n);
+  T *scratch = buffer.data();
+  bool in_buffer = false;
+  while (chunks > 1) {
+    size_t merged = (chunks + 1) / 2;
+    task_group group(pool);
+    for (size_t c = 0; c + 1 < chunks; c += 2) {
+      size_t lo = bounds[c], mid = bounds[c + 1], hi = bounds[c + 2];
+      group.run([&group, &comp, first, scratch, in_buffer, lo, mid, hi] {
+        if (in_buffer) {
+          internal::merge(group, scratch + lo, scratch + mid, scratch + mid,
+                          scratch + hi, first + lo, comp);
+        } else {
+          internal::merge(group, first + lo, first + mid, first + mid,
+                          first + hi, scratch + lo, comp);
+        }
+      });
+    }
+    if (chunks % 2 != 0) {
+      size_t lo = bounds[chunks - 1], hi = bounds[chunks];
+      if (in_buffer) {
+        std::move(scratch + lo, scratch + hi, first + lo);
+      } else {
+        std::move(first + lo, first + hi, scratch + lo);
+      }
+    }
+    group.wait();
+    for (size_t c = 0; c < merged; ++c) {
+      bounds[c + 1] = bounds[std::min(2 * c + 2, chunks)];
+    }
+    chunks = merged;
+    in_buffer = !in_buffer;
+  }
+  if (in_buffer) {
+    internal::for_chunks(pool, n, internal::chunk_count(pool, n),
+                         [&](size_t, size_t lo, size_t hi) {
+                           std::move(scratch + lo, scratch + hi, first + lo);
+                         });
+  }
+}
+
+template <class RandomIt, class Fn>
+void for_each(RandomIt first, RandomIt last, Fn fn) {
+  parallel::for_each(default_pool(), first, last, std::move(fn));
+}
+
+template <class RandomIt, class OutIt, class UnaryOp>
+OutIt transform(RandomIt first, RandomIt last, OutIt d_first, UnaryOp op) {
+  return parallel::transform(default_pool(), first, last, d_first,
+                             std::move(op));
+}
+
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp()) {
+  return parallel::reduce(default_pool(), first, last, std::move(init),
+                          std::move(op));
+}
+
+template <class RandomIt, class OutIt, class BinaryOp = std::plus<>>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt d_first,
+                     BinaryOp op = BinaryOp()) {
+  return parallel::inclusive_scan(default_pool(), first, last, d_first,
+                                  std::move(op));
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  parallel::sort(default_pool(), first, last, std::move(comp));
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_PARALLEL_H
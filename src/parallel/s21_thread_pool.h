@@ -0,0 +1,222 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_THREAD_POOL_H
+#define CPP2_S21_CONTAINERS_1_S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../mpmc_queue/s21_mpmc_queue.h"
+#include "../vector/s21_vector.h"
+#include "../ws_deque/s21_ws_deque.h"
+
+namespace s21 {
+
+// Fixed set of worker threads, each owning a lock-free s21::ws_deque. A
+// worker pushes and pops at the bottom of its own deque and, when that runs
+// dry, steals from the top of the others, so nested fork-join work stays on
+// the thread that spawned it and idle threads take the oldest (largest)
+// pieces. Threads outside the pool cannot own a deque; they submit through a
+// shared s21::mpmc_queue that the workers drain.
+class thread_pool {
+ public:
+  //  Member type
+  using task = std::function<void()>;
+  using size_type = size_t;
+
+  //  Member functions
+  explicit thread_pool(size_type threads = default_concurrency());
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();
+
+  //  Capacity
+  size_type size() const;
+  static size_type default_concurrency();
+
+  //  Modifiers
+  void submit(task t);
+  // Runs one queued task on the calling thread. Returns false if there was
+  // nothing to run.
+  bool run_pending();
+
+ private:
+  struct worker_slot {
+    const thread_pool *pool = nullptr;
+    size_type index = 0;
+  };
+
+  static worker_slot &current_worker();
+  bool steal(size_type thief, task *&out);
+  void worker_loop(size_type index);
+
+  static constexpr size_type kInjectCapacity = 1024;
+
+  size_type workers_;
+  // Deques hold heap-allocated tasks: ws_deque needs trivially copyable
+  // elements, and a pointer is cheap to steal.
+  s21::vector<std::unique_ptr<ws_deque<task *>>> queues_;
+  mpmc_queue<task *> injected_{kInjectCapacity};
+  s21::vector<std::thread> threads_;
+  std::atomic<size_type> queued_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+};
+
+// Set of tasks submitted to a pool that can be waited on together. wait()
+// runs pending pool tasks on the calling thread instead of blocking, so a
+// task may itself open a group and wait on it. The first exception thrown by
+// a task is rethrown from wait().
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool);
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+  ~task_group();
+
+  template <class Fn>
+  void run(Fn &&fn);
+  void wait();
+
+ private:
+  thread_pool &pool_;
+  std::atomic<size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+// thread_pool
+
+inline thread_pool::thread_pool(size_type threads)
+    : workers_(std::max<size_type>(threads, 1)) {
+  queues_.reserve(workers_);
+  for (size_type i = 0; i < workers_; ++i) {
+    queues_.push_back(std::make_unique<ws_deque<task *>>());
+  }
+  threads_.reserve(workers_);
+  for (size_type i = 0; i < workers_; ++i) {
+    threads_.push_back(std::thread(&thread_pool::worker_loop, this, i));
+  }
+}
+
+inline thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &t : threads_) {
+    t.join();
+  }
+}
+
+inline thread_pool::size_type thread_pool::size() const {
+  return workers_;
+}
+
+inline thread_pool::size_type thread_pool::default_concurrency() {
+  return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+}
+
+inline void thread_pool::submit(task t) {
+  worker_slot &self = current_worker();
+  task *queued = new task(std::move(t));
+  // Counted first, so no worker can run and uncount it before this.
+  queued_.fetch_add(1, std::memory_order_release);
+  if (self.pool == this) {
+    queues_[self.index]->push(queued);
+  } else {
+    injected_.push(queued);
+  }
+  {
+    // Taking the lock orders this wake-up after a sleeper's predicate check.
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+  }
+  wake_.notify_one();
+}
+
+inline bool thread_pool::run_pending() {
+  worker_slot &self = current_worker();
+  size_type index = self.pool == this ? self.index : 0;
+  task *t = nullptr;
+  if ((self.pool == this && queues_[index]->pop(t)) || injected_.try_pop(t) ||
+      steal(index, t)) {
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    std::unique_ptr<task> owned(t);
+    (*owned)();
+    return true;
+  }
+  return false;
+}
+
+inline thread_pool::worker_slot &thread_pool::current_worker() {
+  static thread_local worker_slot slot;
+  return slot;
+}
+
+inline bool thread_pool::steal(size_type thief, task *&out) {
+  if (queued_.load(std::memory_order_acquire) == 0) return false;
+  size_type n = workers_;
+  for (size_type i = 1; i <= n; ++i) {
+    if (queues_[(thief + i) % n]->steal(out)) return true;
+  }
+  return false;
+}
+
+inline void thread_pool::worker_loop(size_type index) {
+  current_worker() = worker_slot{this, index};
+  for (;;) {
+    if (run_pending()) continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] {
+      return stop_ || queued_.load(std::memory_order_acquire) > 0;
+    });
+    if (stop_ && queued_.load(std::memory_order_acquire) == 0) return;
+  }
+}
+
+// task_group
+
+inline task_group::task_group(thread_pool &pool) : pool_(pool) {}
+
+inline task_group::~task_group() {
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (!pool_.run_pending()) std::this_thread::yield();
+  }
+}
+
+template <class Fn>
+void task_group::run(Fn &&fn) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  pool_.submit([this, fn = std::forward<Fn>(fn)]() mutable {
+    try {
+      fn();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!error_) error_ = std::current_exception();
+    }
+    pending_.fetch_sub(1, std::memory_order_acq_rel);
+  });
+}
+
+inline void task_group::wait() {
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (!pool_.run_pending()) std::this_thread::yield();
+  }
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_THREAD_POOL_H
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "gtest/gtest.h"
+#include "s21_parallel.h"
+
+namespace {
+
+const size_t kLarge = 300000;
+
+s21::vector<std::int64_t> random_values(size_t n, std::uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::int64_t> dist(-1000, 1000);
+  s21::vector<std::int64_t> v(n);
+  for (size_t i = 0; i < n; ++i) v[i] = dist(gen);
+  return v;
+}
+
+}  // namespace
+
+TEST(thread_pool_suite, runs_every_task) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), static_cast<size_t>(4));
+  std::atomic<int> done{0};
+  s21::task_group group(pool);
+  for (int i = 0; i < 1000; ++i) {
+    group.run([&done] { done.fetch_add(1); });
+  }
+  group.wait();
+  EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(thread_pool_suite, nested_groups_do_not_deadlock) {
+  s21::thread_pool pool(2);
+  std::atomic<int> leaves{0};
+  s21::task_group outer(pool);
+  for (int i = 0; i < 8; ++i) {
+    outer.run([&pool, &leaves] {
+      s21::task_group inner(pool);
+      for (int j = 0; j < 8; ++j) {
+        inner.run([&leaves] { leaves.fetch_add(1); });
+      }
+      inner.wait();
+    });
+  }
+  outer.wait();
+  EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(thread_pool_suite, wait_rethrows_task_exception) {
+  s21::thread_pool pool(2);
+  s21::task_group group(pool);
+  group.run([] { throw std::runtime_error("task failed"); });
+  group.run([] {});
+  EXPECT_THROW(group.wait(), std::runtime_error);
+}
+
+TEST(parallel_suite, for_each_and_transform) {
+  s21::thread_pool pool(3);
+  s21::vector<std::int64_t> v = random_values(kLarge, 1);
+  std::vector<std::int64_t> expected(v.begin(), v.end());
+  s21::parallel::for_each(pool, v.begin(), v.end(),
+                          [](std::int64_t &x) { x *= 3; });
+  s21::vector<std::int64_t> out(kLarge);
+  auto end = s21::parallel::transform(pool, v.begin(), v.end(), out.begin(),
+                                      [](std::int64_t x) { return x + 1; });
+  EXPECT_EQ(end, out.end());
+  for (size_t i = 0; i < kLarge; ++i) {
+    ASSERT_EQ(out[i], expected[i] * 3 + 1);
+  }
+}
+
+TEST(parallel_suite, reduce_keeps_operand_order) {
+  s21::thread_pool pool(4);
+  s21::vector<std::int64_t> v = random_values(kLarge, 2);
+  EXPECT_EQ(s21::parallel::reduce(pool, v.begin(), v.end(), std::int64_t(5)),
+            std::accumulate(v.begin(), v.end(), std::int64_t(5)));
+
+  // String concatenation is associative but not commutative.
+  s21::vector<std::string> words(20000);
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = std::string(1, static_cast<char>('a' + i % 26));
+  }
+  EXPECT_EQ(s21::parallel::reduce(pool, words.begin(), words.end(),
+                                  std::string(">")),
+            std::accumulate(words.begin(), words.end(), std::string(">")));
+
+  s21::array<int, 3> small = {1, 2, 3};
+  EXPECT_EQ(s21::parallel::reduce(small.begin(), small.end(), 10), 16);
+}
+
+TEST(parallel_suite, inclusive_scan_matches_partial_sum) {
+  s21::thread_pool pool(4);
+  for (size_t n : {size_t(0), size_t(1), size_t(5000), kLarge}) {
+    s21::vector<std::int64_t> v = random_values(n, 3);
+    std::vector<std::int64_t> expected(n);
+    std::partial_sum(v.begin(), v.end(), expected.begin());
+    s21::parallel::inclusive_scan(pool, v.begin(), v.end(), v.begin());
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(v[i], expected[i]) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TEST(parallel_suite, sort_matches_std_sort) {
+  s21::thread_pool pool(4);
+  for (size_t n : {size_t(0), size_t(1), size_t(100), size_t(50001), kLarge}) {
+    s21::vector<std::int64_t> v = random_values(n, 4);
+    std::vector<std::int64_t> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    s21::parallel::sort(pool, v.begin(), v.end(), std::greater<>());
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()))
+        << "n=" << n;
+  }
+}
+
+TEST(parallel_suite, sort_strings_with_odd_chunk_count) {
+  s21::thread_pool pool(3);
+  std::mt19937 gen(5);
+  s21::vector<std::string> v(100000);
+  for (std::string &s : v) s = std::to_string(gen());
+  std::vector<std::string> expected(v.begin(), v.end());
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::sort(pool, v.begin(), v.end());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
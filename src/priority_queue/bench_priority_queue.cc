@@ -0,0 +1,200 @@
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../bench/s21_bench.h"
+#include "../set/s21_set.h"
+#include "../vector/s21_vector.h"
+#include "s21_priority_queue.h"
+
+namespace {
+
+const int kReps = 5;
+const std::uint64_t kInf = ~std::uint64_t(0);
+
+using item = std::pair<std::uint64_t, std::uint32_t>;
+using min_queue =
+    s21::priority_queue<item, s21::vector<item>, std::greater<item>>;
+
+struct edge {
+  std::uint32_t to;
+  std::uint64_t weight;
+};
+
+using graph = std::vector<std::vector<edge>>;
+
+s21::vector<std::uint64_t> random_keys(std::size_t n) {
+  std::mt19937_64 rng(42);
+  s21::vector<std::uint64_t> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) keys.push_back(rng());
+  return keys;
+}
+
+graph random_graph(std::uint32_t vertices, int degree) {
+  std::mt19937 rng(7);
+  graph g(vertices);
+  for (std::uint32_t v = 0; v < vertices; ++v) {
+    for (int i = 0; i < degree; ++i) {
+      g[v].push_back({static_cast<std::uint32_t>(rng() % vertices),
+                      rng() % 1000 + 1});
+    }
+  }
+  return g;
+}
+
+// n pushes followed by n pops; Push and Pop adapt each queue's API.
+template <class Queue, class Push, class Pop>
+void push_pop(const char *name, s21::vector<std::uint64_t> &keys, Push push,
+              Pop pop) {
+  double ns = s21::bench::measure(kReps, [&] {
+    Queue q;
+    for (std::uint64_t k : keys) push(q, k);
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) sum += pop(q);
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, keys.size(), keys.size() * 2, ns);
+}
+
+// The scheduler pattern the ordered tree has been used for: a set of
+// (distance, vertex), decrease-key by erase + insert. s21::set rather than
+// s21::multiset because each pair is unique and the multiset does not
+// compile insert().
+std::uint64_t dijkstra_set(const graph &g) {
+  std::vector<std::uint64_t> dist(g.size(), kInf);
+  s21::set<item> queue;
+  dist[0] = 0;
+  queue.insert({0, 0});
+  while (!queue.empty()) {
+    auto it = queue.begin();
+    item top = *it;
+    queue.erase(it);
+    for (const edge &e : g[top.second]) {
+      std::uint64_t nd = top.first + e.weight;
+      if (nd >= dist[e.to]) continue;
+      if (dist[e.to] != kInf) queue.erase(queue.find({dist[e.to], e.to}));
+      dist[e.to] = nd;
+      queue.insert({nd, e.to});
+    }
+  }
+  return dist.back();
+}
+
+// Lazy deletion: stale entries stay queued and are skipped when popped.
+std::uint64_t dijkstra_lazy(const graph &g) {
+  std::vector<std::uint64_t> dist(g.size(), kInf);
+  min_queue queue;
+  dist[0] = 0;
+  queue.push({0, 0});
+  while (!queue.empty()) {
+    item top = queue.top();
+    queue.pop();
+    if (top.first != dist[top.second]) continue;
+    for (const edge &e : g[top.second]) {
+      std::uint64_t nd = top.first + e.weight;
+      if (nd >= dist[e.to]) continue;
+      dist[e.to] = nd;
+      queue.push({nd, e.to});
+    }
+  }
+  return dist.back();
+}
+
+template <std::size_t Arity>
+std::uint64_t dijkstra_indexed(const graph &g) {
+  using heap = s21::indexed_heap<item, std::less<item>, Arity>;
+  const std::size_t kNotQueued = ~std::size_t(0);
+  std::vector<std::uint64_t> dist(g.size(), kInf);
+  std::vector<std::size_t> handle(g.size(), kNotQueued);
+  heap queue;
+  dist[0] = 0;
+  handle[0] = queue.push({0, 0});
+  while (!queue.empty()) {
+    item top = queue.top();
+    queue.pop();
+    handle[top.second] = kNotQueued;
+    for (const edge &e : g[top.second]) {
+      std::uint64_t nd = top.first + e.weight;
+      if (nd >= dist[e.to]) continue;
+      dist[e.to] = nd;
+      if (handle[e.to] != kNotQueued) {
+        queue.decrease_key(handle[e.to], {nd, e.to});
+      } else {
+        handle[e.to] = queue.push({nd, e.to});
+      }
+    }
+  }
+  return dist.back();
+}
+
+void dijkstra(const char *name, const graph &g,
+              std::uint64_t (*run)(const graph &)) {
+  double ns = s21::bench::measure(
+      kReps, [&] { s21::bench::do_not_optimize(run(g)); });
+  s21::bench::report(name, g.size(), ns);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 12, std::size_t(1) << 18}) {
+    s21::vector<std::uint64_t> keys = random_keys(n);
+    push_pop<std::priority_queue<std::uint64_t>>(
+        "std::priority_queue push+pop", keys,
+        [](auto &q, std::uint64_t k) { q.push(k); },
+        [](auto &q) {
+          std::uint64_t k = q.top();
+          q.pop();
+          return k;
+        });
+    push_pop<s21::priority_queue<std::uint64_t>>(
+        "s21::priority_queue push+pop", keys,
+        [](auto &q, std::uint64_t k) { q.push(k); },
+        [](auto &q) {
+          std::uint64_t k = q.top();
+          q.pop();
+          return k;
+        });
+    push_pop<s21::indexed_heap<std::uint64_t>>(
+        "s21::indexed_heap<4> push+pop", keys,
+        [](auto &q, std::uint64_t k) { q.push(k); },
+        [](auto &q) {
+          std::uint64_t k = q.top();
+          q.pop();
+          return k;
+        });
+    push_pop<s21::set<std::uint64_t>>(
+        "s21::set insert+erase(begin)", keys,
+        [](auto &q, std::uint64_t k) { q.insert(k); },
+        [](auto &q) {
+          auto it = q.begin();
+          std::uint64_t k = *it;
+          q.erase(it);
+          return k;
+        });
+
+    double ns = s21::bench::measure(kReps, [&keys] {
+      s21::priority_queue<std::uint64_t> q;
+      for (std::uint64_t k : keys) q.push(k);
+      s21::bench::do_not_optimize(q.top());
+    });
+    s21::bench::report("s21::priority_queue build by push", n, ns);
+    ns = s21::bench::measure(kReps, [&keys] {
+      s21::priority_queue<std::uint64_t> q(keys.begin(), keys.end());
+      s21::bench::do_not_optimize(q.top());
+    });
+    s21::bench::report("s21::priority_queue build by make_heap", n, ns);
+  }
+
+  graph g = random_graph(std::uint32_t(1) << 17, 8);
+  dijkstra("dijkstra s21::set", g, dijkstra_set);
+  dijkstra("dijkstra s21::priority_queue lazy", g, dijkstra_lazy);
+  dijkstra("dijkstra s21::indexed_heap<2>", g, dijkstra_indexed<2>);
+  dijkstra("dijkstra s21::indexed_heap<4>", g, dijkstra_indexed<4>);
+  dijkstra("dijkstra s21::indexed_heap<8>", g, dijkstra_indexed<8>);
+  return 0;
+}
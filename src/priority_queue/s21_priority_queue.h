@@ -0,0 +1,476 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_PRIORITY_QUEUE_H
+#define CPP2_S21_CONTAINERS_1_S21_PRIORITY_QUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Binary max-heap adaptor over a random-access Container, which needs
+// begin()/end(), front(), push_back() and pop_back(). top() is the element
+// that no other element compares greater than under Compare, so
+// std::greater<T> gives a min-queue. The elements stay in one contiguous
+// s21::vector by default: a push or pop touches log(n) slots of one array
+// instead of rebalancing a node-per-element tree. As with s21::stack, top()
+// of an empty queue is a default T and pop() does nothing.
+template <class T, class Container = s21::vector<T>,
+          class Compare = std::less<T>>
+class priority_queue {
+ public:
+  //  Member type
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  //  Member functions
+  priority_queue() = default;
+  explicit priority_queue(const Compare &comp);
+  // Take the elements of c and heapify them in O(n).
+  priority_queue(const Compare &comp, Container &&c);
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare());
+  template <class InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare &comp = Compare());
+
+  //  Element access
+  const_reference top() const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+
+  //  Modifiers
+  void push(const_reference value);
+  void push(value_type &&value);
+  template <typename... Args>
+  void emplace(Args &&...args);
+  void pop();
+  void swap(priority_queue &other);
+
+  // Appends [first, last) and restores the heap once: a batch at least as
+  // large as the queue is heapified in O(n) with the rest, a smaller one is
+  // sifted up element by element.
+  template <class InputIt>
+  void push_many(InputIt first, InputIt last);
+
+ private:
+  Container c_;
+  Compare comp_;
+};
+
+// Min-heap with arity Arity whose elements can be found again through the
+// handle that push() returns, so a queued element can be re-prioritised or
+// removed in O(log n) without searching for it. Unlike priority_queue, top()
+// is the element that compares least under Compare: that is the order
+// Dijkstra, A* and timer queues consume, and decrease_key() moves an element
+// towards the top. A wider node (Arity 4 by default) halves the depth of a
+// binary heap, and its children share one or two cache lines, which favours
+// the decrease_key-heavy workloads this is meant for.
+//
+// Handles are small integers; one is valid from the push() that returns it
+// until that element is popped or erased, and may be reused afterwards.
+// top(), top_handle() and pop() on an empty heap throw std::out_of_range,
+// as a stale handle does.
+template <class T, class Compare = std::less<T>, std::size_t Arity = 4>
+class indexed_heap {
+  static_assert(Arity >= 2, "indexed_heap arity must be at least 2");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using value_compare = Compare;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+
+  static constexpr size_type kArity = Arity;
+
+  //  Member functions
+  indexed_heap() = default;
+  explicit indexed_heap(const Compare &comp) : comp_(comp) {}
+
+  //  Element access
+  const_reference top() const;
+  handle_type top_handle() const;
+  const_reference value(handle_type handle) const;
+  bool contains(handle_type handle) const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+
+  //  Modifiers
+  handle_type push(const_reference value);
+  handle_type push(value_type &&value);
+  template <typename... Args>
+  handle_type emplace(Args &&...args);
+  void pop();
+  // Replace the element of handle with one that does not compare greater
+  // than it; throws std::invalid_argument otherwise.
+  void decrease_key(handle_type handle, const_reference value);
+  // Replace the element of handle with any value.
+  void update(handle_type handle, const_reference value);
+  void erase(handle_type handle);
+  void clear();
+  void swap(indexed_heap &other);
+
+ private:
+  static constexpr size_type kNone = static_cast<size_type>(-1);
+
+  struct entry {
+    T value;
+    handle_type handle;
+  };
+
+  // heap_ holds the entries in heap order; position_[h] is where handle h
+  // sits in it, or kNone for a free handle; free_ lists handles to reuse.
+  s21::vector<entry> heap_;
+  s21::vector<size_type> position_;
+  s21::vector<handle_type> free_;
+  Compare comp_;
+
+  size_type checked_position(handle_type handle) const;
+  void check_not_empty() const;
+  handle_type insert(value_type &&value);
+  void remove_at(size_type pos);
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+  void place(entry &&e, size_type pos);
+};
+
+// CONSTRUCTOR
+
+template <class T, class Container, class Compare>
+priority_queue<T, Container, Compare>::priority_queue(const Compare &comp)
+    : c_(), comp_(comp) {}
+
+template <class T, class Container, class Compare>
+priority_queue<T, Container, Compare>::priority_queue(const Compare &comp,
+                                                      Container &&c)
+    : c_(std::move(c)), comp_(comp) {
+  std::make_heap(c_.begin(), c_.end(), comp_);
+}
+
+template <class T, class Container, class Compare>
+priority_queue<T, Container, Compare>::priority_queue(
+    std::initializer_list<value_type> const &items, const Compare &comp)
+    : c_(items), comp_(comp) {
+  std::make_heap(c_.begin(), c_.end(), comp_);
+}
+
+template <class T, class Container, class Compare>
+template <class InputIt>
+priority_queue<T, Container, Compare>::priority_queue(InputIt first,
+                                                      InputIt last,
+                                                      const Compare &comp)
+    : c_(), comp_(comp) {
+  for (; first != last; ++first) c_.push_back(*first);
+  std::make_heap(c_.begin(), c_.end(), comp_);
+}
+
+// Element access
+
+template <class T, class Container, class Compare>
+typename priority_queue<T, Container, Compare>::const_reference
+priority_queue<T, Container, Compare>::top() const {
+  static const T default_value = T{};
+  if (c_.empty()) {
+    return default_value;
+  }
+  return c_.front();
+}
+
+// Capacity
+
+template <class T, class Container, class Compare>
+bool priority_queue<T, Container, Compare>::empty() const {
+  return c_.empty();
+}
+
+template <class T, class Container, class Compare>
+typename priority_queue<T, Container, Compare>::size_type
+priority_queue<T, Container, Compare>::size() const {
+  return c_.size();
+}
+
+// Modifiers
+
+template <class T, class Container, class Compare>
+void priority_queue<T, Container, Compare>::push(const_reference value) {
+  c_.push_back(value);
+  std::push_heap(c_.begin(), c_.end(), comp_);
+}
+
+template <class T, class Container, class Compare>
+void priority_queue<T, Container, Compare>::push(value_type &&value) {
+  c_.push_back(std::move(value));
+  std::push_heap(c_.begin(), c_.end(), comp_);
+}
+
+template <class T, class Container, class Compare>
+template <typename... Args>
+void priority_queue<T, Container, Compare>::emplace(Args &&...args) {
+  push(value_type(std::forward<Args>(args)...));
+}
+
+template <class T, class Container, class Compare>
+void priority_queue<T, Container, Compare>::pop() {
+  if (c_.empty()) {
+    return;
+  }
+  std::pop_heap(c_.begin(), c_.end(), comp_);
+  c_.pop_back();
+}
+
+template <class T, class Container, class Compare>
+void priority_queue<T, Container, Compare>::swap(priority_queue &other) {
+  c_.swap(other.c_);
+  std::swap(comp_, other.comp_);
+}
+
+template <class T, class Container, class Compare>
+template <class InputIt>
+void priority_queue<T, Container, Compare>::push_many(InputIt first,
+                                                      InputIt last) {
+  size_type old_size = c_.size();
+  for (; first != last; ++first) c_.push_back(*first);
+  size_type added = c_.size() - old_size;
+  if (added >= old_size) {
+    std::make_heap(c_.begin(), c_.end(), comp_);
+  } else {
+    auto begin = c_.begin();
+    for (size_type i = old_size + 1; i <= c_.size(); ++i) {
+      std::push_heap(begin, begin + i, comp_);
+    }
+  }
+}
+
+// Element access
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::const_reference
+indexed_heap<T, Compare, Arity>::top() const {
+  check_not_empty();
+  return heap_[0].value;
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::handle_type
+indexed_heap<T, Compare, Arity>::top_handle() const {
+  check_not_empty();
+  return heap_[0].handle;
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::const_reference
+indexed_heap<T, Compare, Arity>::value(handle_type handle) const {
+  return heap_[checked_position(handle)].value;
+}
+
+template <class T, class Compare, std::size_t Arity>
+bool indexed_heap<T, Compare, Arity>::contains(handle_type handle) const {
+  return handle < position_.size() && position_[handle] != kNone;
+}
+
+// Capacity
+
+template <class T, class Compare, std::size_t Arity>
+bool indexed_heap<T, Compare, Arity>::empty() const {
+  return heap_.empty();
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::size_type
+indexed_heap<T, Compare, Arity>::size() const {
+  return heap_.size();
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::reserve(size_type size) {
+  heap_.reserve(size);
+  position_.reserve(size);
+}
+
+// Modifiers
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::handle_type
+indexed_heap<T, Compare, Arity>::push(const_reference value) {
+  return insert(value_type(value));
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::handle_type
+indexed_heap<T, Compare, Arity>::push(value_type &&value) {
+  return insert(std::move(value));
+}
+
+template <class T, class Compare, std::size_t Arity>
+template <typename... Args>
+typename indexed_heap<T, Compare, Arity>::handle_type
+indexed_heap<T, Compare, Arity>::emplace(Args &&...args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::pop() {
+  check_not_empty();
+  remove_at(0);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::decrease_key(handle_type handle,
+                                                   const_reference value) {
+  size_type pos = checked_position(handle);
+  if (comp_(heap_[pos].value, value)) {
+    throw std::invalid_argument("decrease_key would increase the key");
+  }
+  heap_[pos].value = value;
+  sift_up(pos);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::update(handle_type handle,
+                                             const_reference value) {
+  size_type pos = checked_position(handle);
+  bool up = comp_(value, heap_[pos].value);
+  heap_[pos].value = value;
+  if (up) {
+    sift_up(pos);
+  } else {
+    sift_down(pos);
+  }
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::erase(handle_type handle) {
+  remove_at(checked_position(handle));
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::clear() {
+  heap_.clear();
+  position_.clear();
+  free_.clear();
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::swap(indexed_heap &other) {
+  heap_.swap(other.heap_);
+  position_.swap(other.position_);
+  free_.swap(other.free_);
+  std::swap(comp_, other.comp_);
+}
+
+// Heap
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::size_type
+indexed_heap<T, Compare, Arity>::checked_position(handle_type handle) const {
+  if (!contains(handle)) {
+    throw std::out_of_range("Handle is not in the heap");
+  }
+  return position_[handle];
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::check_not_empty() const {
+  if (heap_.empty()) {
+    throw std::out_of_range("Heap is empty");
+  }
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::handle_type
+indexed_heap<T, Compare, Arity>::insert(value_type &&value) {
+  handle_type handle;
+  if (free_.empty()) {
+    handle = position_.size();
+    position_.push_back(kNone);
+  } else {
+    handle = free_.back();
+    free_.pop_back();
+  }
+  size_type pos = heap_.size();
+  heap_.push_back(entry{std::move(value), handle});
+  position_[handle] = pos;
+  sift_up(pos);
+  return handle;
+}
+
+// Moves the last entry into the hole at pos and sifts it whichever way it
+// belongs; the removed handle goes on the free list.
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::remove_at(size_type pos) {
+  handle_type handle = heap_[pos].handle;
+  size_type last = heap_.size() - 1;
+  if (pos != last) {
+    heap_[pos] = std::move(heap_[last]);
+    position_[heap_[pos].handle] = pos;
+  }
+  heap_.pop_back();
+  position_[handle] = kNone;
+  free_.push_back(handle);
+  if (pos != last) {
+    if (pos > 0 && comp_(heap_[pos].value, heap_[(pos - 1) / Arity].value)) {
+      sift_up(pos);
+    } else {
+      sift_down(pos);
+    }
+  }
+}
+
+// Both sifts lift the moving entry out and shift the others into the hole,
+// so each level costs one move instead of a swap.
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::sift_up(size_type pos) {
+  entry moving = std::move(heap_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!comp_(moving.value, heap_[parent].value)) break;
+    place(std::move(heap_[parent]), pos);
+    pos = parent;
+  }
+  place(std::move(moving), pos);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::sift_down(size_type pos) {
+  size_type count = heap_.size();
+  entry moving = std::move(heap_[pos]);
+  for (;;) {
+    size_type first = pos * Arity + 1;
+    if (first >= count) break;
+    size_type last = std::min(first + Arity, count);
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp_(heap_[child].value, heap_[best].value)) best = child;
+    }
+    if (!comp_(heap_[best].value, moving.value)) break;
+    place(std::move(heap_[best]), pos);
+    pos = best;
+  }
+  place(std::move(moving), pos);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::place(entry &&e, size_type pos) {
+  position_[e.handle] = pos;
+  heap_[pos] = std::move(e);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_PRIORITY_QUEUE_H
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../deque/s21_deque.h"
+#include "gtest/gtest.h"
+#include "s21_priority_queue.h"
+
+namespace {
+
+// Orders by the second field only, so equal keys with different payloads
+// exercise ties.
+struct by_second {
+  bool operator()(const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) const {
+    return a.second < b.second;
+  }
+};
+
+struct edge {
+  int to;
+  std::uint64_t weight;
+};
+
+using graph = std::vector<std::vector<edge>>;
+
+graph random_graph(int vertices, int degree, unsigned seed) {
+  std::mt19937 rng(seed);
+  graph g(vertices);
+  for (int v = 0; v < vertices; ++v) {
+    for (int i = 0; i < degree; ++i) {
+      g[v].push_back({static_cast<int>(rng() % vertices), rng() % 100 + 1});
+    }
+  }
+  return g;
+}
+
+}  // namespace
+
+TEST(priority_queue_suite, matches_std_priority_queue) {
+  s21::priority_queue<int> s;
+  std::priority_queue<int> expected;
+  std::mt19937 rng(7);
+  EXPECT_TRUE(s.empty());
+  for (int i = 0; i < 2000; ++i) {
+    if (rng() % 3 != 0 || expected.empty()) {
+      int v = static_cast<int>(rng() % 500);
+      s.push(v);
+      expected.push(v);
+    } else {
+      EXPECT_EQ(s.top(), expected.top());
+      s.pop();
+      expected.pop();
+    }
+    EXPECT_EQ(s.size(), expected.size());
+  }
+  while (!expected.empty()) {
+    EXPECT_EQ(s.top(), expected.top());
+    s.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(priority_queue_suite, custom_comparator_and_container) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> min_queue = {
+      5, 1, 4, 2, 3};
+  for (int i = 1; i <= 5; ++i) {
+    EXPECT_EQ(min_queue.top(), i);
+    min_queue.pop();
+  }
+
+  s21::priority_queue<std::pair<int, int>, s21::deque<std::pair<int, int>>,
+                      by_second>
+      q;
+  q.push({1, 10});
+  q.emplace(2, 30);
+  q.push({3, 20});
+  EXPECT_EQ(q.top().first, 2);
+  q.pop();
+  EXPECT_EQ(q.top().first, 3);
+}
+
+TEST(priority_queue_suite, bulk_construction) {
+  s21::vector<std::string> words = {"pear", "apple", "fig", "kiwi", "plum"};
+  s21::priority_queue<std::string> from_range(words.begin(), words.end());
+  s21::priority_queue<std::string> adopted(std::less<std::string>(),
+                                           std::move(words));
+  std::string order[] = {"plum", "pear", "kiwi", "fig", "apple"};
+  for (const std::string &w : order) {
+    EXPECT_EQ(from_range.top(), w);
+    EXPECT_EQ(adopted.top(), w);
+    from_range.pop();
+    adopted.pop();
+  }
+  EXPECT_TRUE(adopted.empty());
+}
+
+TEST(priority_queue_suite, push_many_small_and_large_batches) {
+  s21::priority_queue<int> q = {50, 40, 30, 20};
+  int small[] = {45, 5};
+  q.push_many(small, small + 2);
+  s21::vector<int> large;
+  for (int i = 0; i < 100; ++i) large.push_back((i * 37) % 101);
+  q.push_many(large.begin(), large.end());
+  EXPECT_EQ(q.size(), static_cast<size_t>(106));
+  int previous = q.top();
+  while (!q.empty()) {
+    EXPECT_LE(q.top(), previous);
+    previous = q.top();
+    q.pop();
+  }
+
+  s21::priority_queue<int> a = {1}, b = {2, 3};
+  a.swap(b);
+  EXPECT_EQ(a.top(), 3);
+  EXPECT_EQ(b.size(), static_cast<size_t>(1));
+}
+
+TEST(priority_queue_suite, const_access_and_empty_queue) {
+  s21::priority_queue<int> q;
+  q.pop();
+  EXPECT_EQ(q.top(), 0);
+  q.push(3);
+  q.push(7);
+  const s21::priority_queue<int> &view = q;
+  EXPECT_EQ(view.top(), 7);
+  EXPECT_EQ(view.size(), static_cast<size_t>(2));
+  EXPECT_FALSE(view.empty());
+  q.pop();
+  q.pop();
+  q.pop();
+  EXPECT_TRUE(view.empty());
+}
+
+TEST(indexed_heap_suite, pops_in_order_and_reuses_handles) {
+  s21::indexed_heap<int, std::less<int>, 3> h;
+  std::mt19937 rng(3);
+  s21::vector<int> values;
+  for (int i = 0; i < 500; ++i) {
+    int v = static_cast<int>(rng() % 1000);
+    values.push_back(v);
+    h.push(v);
+  }
+  std::sort(values.begin(), values.end());
+  for (int v : values) {
+    EXPECT_EQ(h.top(), v);
+    EXPECT_EQ(h.value(h.top_handle()), v);
+    h.pop();
+  }
+  EXPECT_TRUE(h.empty());
+
+  auto first = h.push(1);
+  h.pop();
+  EXPECT_FALSE(h.contains(first));
+  EXPECT_EQ(h.push(2), first);
+  EXPECT_TRUE(h.contains(first));
+}
+
+TEST(indexed_heap_suite, decrease_key_and_update) {
+  s21::indexed_heap<int> h;
+  s21::vector<s21::indexed_heap<int>::handle_type> handles;
+  for (int i = 0; i < 64; ++i) handles.push_back(h.push(100 + i));
+  h.decrease_key(handles[40], 7);
+  EXPECT_EQ(h.top(), 7);
+  EXPECT_EQ(h.top_handle(), handles[40]);
+  EXPECT_THROW(h.decrease_key(handles[3], 500), std::invalid_argument);
+  EXPECT_EQ(h.value(handles[3]), 103);
+
+  h.update(handles[40], 1000);
+  EXPECT_EQ(h.top(), 100);
+  h.update(handles[63], 0);
+  EXPECT_EQ(h.top_handle(), handles[63]);
+  int previous = h.top();
+  while (!h.empty()) {
+    EXPECT_GE(h.top(), previous);
+    previous = h.top();
+    h.pop();
+  }
+  EXPECT_EQ(previous, 1000);
+}
+
+TEST(indexed_heap_suite, erase_by_handle) {
+  s21::indexed_heap<std::string, std::greater<std::string>, 2> h;
+  auto a = h.push("alpha");
+  auto b = h.emplace("bravo");
+  auto c = h.push("charlie");
+  auto d = h.push("delta");
+  h.erase(d);
+  h.erase(a);
+  EXPECT_EQ(h.size(), static_cast<size_t>(2));
+  EXPECT_EQ(h.top(), "charlie");
+  EXPECT_THROW(h.erase(a), std::out_of_range);
+  EXPECT_THROW(h.value(42), std::out_of_range);
+  h.erase(c);
+  EXPECT_EQ(h.top_handle(), b);
+  h.clear();
+  EXPECT_TRUE(h.empty());
+  EXPECT_FALSE(h.contains(b));
+}
+
+TEST(indexed_heap_suite, const_access_and_empty_heap) {
+  s21::indexed_heap<int> h;
+  EXPECT_THROW(h.top(), std::out_of_range);
+  EXPECT_THROW(h.top_handle(), std::out_of_range);
+  EXPECT_THROW(h.pop(), std::out_of_range);
+  auto a = h.push(5);
+  auto b = h.push(2);
+  const s21::indexed_heap<int> &view = h;
+  EXPECT_EQ(view.top(), 2);
+  EXPECT_EQ(view.top_handle(), b);
+  EXPECT_EQ(view.value(a), 5);
+  EXPECT_TRUE(view.contains(a));
+  EXPECT_EQ(view.size(), static_cast<size_t>(2));
+  EXPECT_FALSE(view.empty());
+}
+
+TEST(indexed_heap_suite, dijkstra_matches_lazy_priority_queue) {
+  const int n = 300;
+  graph g = random_graph(n, 4, 11);
+  const std::uint64_t kInf = ~std::uint64_t(0);
+
+  std::vector<std::uint64_t> lazy(n, kInf);
+  using item = std::pair<std::uint64_t, int>;
+  s21::priority_queue<item, s21::vector<item>, std::greater<item>> q;
+  lazy[0] = 0;
+  q.push({0, 0});
+  while (!q.empty()) {
+    auto [d, v] = q.top();
+    q.pop();
+    if (d != lazy[v]) continue;
+    for (const edge &e : g[v]) {
+      if (d + e.weight < lazy[e.to]) {
+        lazy[e.to] = d + e.weight;
+        q.push({lazy[e.to], e.to});
+      }
+    }
+  }
+
+  std::vector<std::uint64_t> dist(n, kInf);
+  std::vector<size_t> handle(n);
+  std::vector<bool> queued(n, false);
+  s21::indexed_heap<item> h;
+  dist[0] = 0;
+  handle[0] = h.push({0, 0});
+  queued[0] = true;
+  while (!h.empty()) {
+    auto [d, v] = h.top();
+    h.pop();
+    queued[v] = false;
+    for (const edge &e : g[v]) {
+      std::uint64_t nd = d + e.weight;
+      if (nd >= dist[e.to]) continue;
+      dist[e.to] = nd;
+      if (queued[e.to]) {
+        h.decrease_key(handle[e.to], {nd, e.to});
+      } else {
+        handle[e.to] = h.push({nd, e.to});
+        queued[e.to] = true;
+      }
+    }
+  }
+  EXPECT_EQ(dist, lazy);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
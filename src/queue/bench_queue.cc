@@ -0,0 +1,60 @@
+#include <cstddef>
+
+#include "../bench/s21_bench.h"
+#include "../list/s21_list.h"
+#include "s21_queue.h"
+
+namespace {
+
+const int kReps = 5;
+
+// A producer that runs ahead of its consumer by depth items: each round
+// pushes one item and hands the oldest one on.
+template <class Queue>
+void steady(const char *name, std::size_t depth, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [depth, n] {
+    Queue q;
+    for (std::size_t i = 0; i < depth; ++i) q.push(static_cast<int>(i));
+    long long sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      q.push(static_cast<int>(i));
+      sum += q.front();
+      q.pop_front();
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, depth, 2 * n, ns);
+}
+
+// Producer and consumer taking turns in bursts of burst items.
+template <class Queue>
+void bursts(const char *name, std::size_t burst, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [burst, n] {
+    Queue q;
+    long long sum = 0;
+    for (std::size_t done = 0; done < n; done += burst) {
+      for (std::size_t i = 0; i < burst; ++i) q.push(static_cast<int>(i));
+      while (!q.empty()) {
+        sum += q.front();
+        q.pop_front();
+      }
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, burst, 2 * n, ns);
+}
+
+}  // namespace
+
+int main() {
+  std::size_t n = std::size_t(1) << 22;
+  for (std::size_t depth : {std::size_t(16), std::size_t(1) << 16}) {
+    steady<s21::queue<int, s21::list<int>>>("s21::queue<int, list> steady",
+                                            depth, n);
+    steady<s21::queue<int>>("s21::queue<int, deque> steady", depth, n);
+  }
+  bursts<s21::queue<int, s21::list<int>>>("s21::queue<int, list> bursts",
+                                          4096, n);
+  bursts<s21::queue<int>>("s21::queue<int, deque> bursts", 4096, n);
+  return 0;
+}
@@ -1,14 +1,21 @@
 #ifndef CONTAINERS_QUEUE_H
 #define CONTAINERS_QUEUE_H
 
-#include "../list/s21_list.h"
-#include "iostream"
+#include <initializer_list>
+#include <utility>
+
+#include "../deque/s21_deque.h"
 
 namespace s21 {
-template <class T>
-class queue : protected list<T> {
+// FIFO adaptor over Container, which needs front(), back(), push_back() and
+// pop_front(). The default s21::deque keeps the elements in one ring buffer,
+// so push and pop_front allocate only when the ring doubles; s21::list still
+// works as the Container.
+template <class T, class Container = s21::deque<T>>
+class queue {
  public:
   // Member type
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -24,67 +31,97 @@ class queue : protected list<T> {
   queue &operator=(queue &&q) noexcept;
 
   // Element access
-  using list<T>::front;
-  using list<T>::back;
+  const_reference front();
+  const_reference back();
 
   // Capacity
-  using list<T>::empty;
-  using list<T>::size;
+  bool empty() const;
+  size_type size() const;
 
   //   Modifiers
   void push(const_reference value);
-  using list<T>::pop_front;
+  void pop_front();
   void swap(queue &other);
 
   // Modifiers DOP
   template <class... Args>
   void insert_many_back(Args &&...args);
+
+ private:
+  Container c_;
 };
 
 ////////////////////////////////// Constructor ///////////////////////////////
-template <class T>
-queue<T>::queue() : list<T>() {}
+template <class T, class Container>
+queue<T, Container>::queue() : c_() {}
 
-template <class T>
-queue<T>::queue(std::initializer_list<value_type> const &items)
-    : list<T>(items) {}
+template <class T, class Container>
+queue<T, Container>::queue(std::initializer_list<value_type> const &items)
+    : c_(items) {}
 
-template <class T>
-queue<T>::queue(const queue &q) : list<T>(q) {}
+template <class T, class Container>
+queue<T, Container>::queue(const queue &q) : c_(q.c_) {}
 
-template <class T>
-queue<T>::queue(queue &&q) noexcept : list<T>(std::move(q)) {}
+template <class T, class Container>
+queue<T, Container>::queue(queue &&q) noexcept : c_(std::move(q.c_)) {}
 
-template <class T>
-queue<T>::~queue() {}
+template <class T, class Container>
+queue<T, Container>::~queue() {}
 
 //////////////////////////// Operator Constructor /////////////////?//////////
-template <class T>
-queue<T> &queue<T>::operator=(queue &&q) noexcept {
+template <class T, class Container>
+queue<T, Container> &queue<T, Container>::operator=(queue &&q) noexcept {
   if (this != &q) {
-    list<T>::operator=(std::move(q));
+    c_ = std::move(q.c_);
   }
   return *this;
 }
 
+////////////////////////////////// Access //////////////////////////////////
+template <class T, class Container>
+typename queue<T, Container>::const_reference queue<T, Container>::front() {
+  return c_.front();
+}
+
+template <class T, class Container>
+typename queue<T, Container>::const_reference queue<T, Container>::back() {
+  return c_.back();
+}
+
+////////////////////////////////// Capacity //////////////////////////////////
+template <class T, class Container>
+bool queue<T, Container>::empty() const {
+  return c_.empty();
+}
+
+template <class T, class Container>
+typename queue<T, Container>::size_type queue<T, Container>::size() const {
+  return c_.size();
+}
+
 ////////////////////////////////// Modifiers //////////////////////////////////
-template <class T>
-void queue<T>::push(const_reference value) {
-  list<T>::push_back(value);
+template <class T, class Container>
+void queue<T, Container>::push(const_reference value) {
+  c_.push_back(value);
+}
+
+template <class T, class Container>
+void queue<T, Container>::pop_front() {
+  c_.pop_front();
 }
 
-template <class T>
-void queue<T>::swap(queue &other) {
-  list<T>::swap(other);
+template <class T, class Container>
+void queue<T, Container>::swap(queue &other) {
+  c_.swap(other.c_);
 }
 
 /////////////////////////////// Modifiers DOP ///////////////////////////////
-template <class T>
+template <class T, class Container>
 template <typename... Args>
-void queue<T>::insert_many_back(Args &&...args) {
-  list<T>::insert_many_back(args...);
+void queue<T, Container>::insert_many_back(Args &&...args) {
+  c_.insert_many_back(std::forward<Args>(args)...);
 }
 
 }  // namespace s21
 
-#endif  // CONTAINERS_QUEUE_H
\ No newline at end of file
+#endif  // CONTAINERS_QUEUE_H
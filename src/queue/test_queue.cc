@@ -1,5 +1,7 @@
 #include <queue>
 
+#include "../allocator/s21_allocator.h"
+#include "../list/s21_list.h"
 #include "gtest/gtest.h"
 #include "s21_queue.h"
 
@@ -203,6 +205,63 @@ TEST(queue_insert_many_back, insert) {
   EXPECT_TRUE(s21_a.back() == 6);
 }
 
+TEST(queue_container_suite, pop_on_empty) {
+  s21::queue<int> s21_a;
+  s21_a.pop_front();
+  EXPECT_TRUE(s21_a.empty());
+  s21_a.push(1);
+  s21_a.pop_front();
+  s21_a.pop_front();
+  s21_a.push(2);
+  EXPECT_EQ(s21_a.front(), 2);
+  EXPECT_EQ(s21_a.size(), static_cast<size_t>(1));
+}
+
+TEST(queue_container_suite, list_backed) {
+  s21::queue<int, s21::list<int>> s21_a({1, 2});
+  std::queue<int> std_a({1, 2});
+  for (int i = 3; i <= 100; ++i) {
+    s21_a.push(i);
+    std_a.push(i);
+    if (i % 4 == 0) {
+      s21_a.pop_front();
+      std_a.pop();
+    }
+  }
+  EXPECT_EQ(s21_a.back(), std_a.back());
+  while (!std_a.empty()) {
+    EXPECT_EQ(s21_a.front(), std_a.front());
+    s21_a.pop_front();
+    std_a.pop();
+  }
+  EXPECT_TRUE(s21_a.empty());
+}
+
+TEST(queue_container_suite, pool_list_backed) {
+  s21::queue<int, s21::list<int, s21::pool_allocator<int>>> s21_a;
+  std::queue<int> std_a;
+  for (int i = 0; i < 1000; ++i) {
+    s21_a.push(i);
+    std_a.push(i);
+    if (i % 3 != 0) {
+      EXPECT_EQ(s21_a.front(), std_a.front());
+      s21_a.pop_front();
+      std_a.pop();
+    }
+  }
+  EXPECT_EQ(s21_a.size(), std_a.size());
+  EXPECT_EQ(s21_a.back(), std_a.back());
+}
+
+TEST(queue_container_suite, const_capacity) {
+  const s21::queue<int> s21_a({1, 2, 3});
+  const s21::queue<int> s21_b;
+
+  EXPECT_EQ(s21_a.size(), 3U);
+  EXPECT_FALSE(s21_a.empty());
+  EXPECT_TRUE(s21_b.empty());
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
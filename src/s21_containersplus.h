@@ -1,7 +1,23 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H
 #define CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H
 
+#include "allocator/s21_allocator.h"
 #include "array/s21_array.h"
+#include "concurrent_stack/s21_concurrent_stack.h"
+#include "deque/s21_deque.h"
+#include "intrusive/s21_intrusive.h"
+#include "mmap_vector/s21_mmap_vector.h"
+#include "mpmc_queue/s21_mpmc_queue.h"
 #include "multiset/s21_multiset.h"
+#include "parallel/s21_parallel.h"
+#include "priority_queue/s21_priority_queue.h"
+#include "segmented_vector/s21_segmented_vector.h"
+#include "simd/s21_simd.h"
+#include "small_vector/s21_small_vector.h"
+#include "soa_vector/s21_soa_vector.h"
+#include "spsc_queue/s21_spsc_queue.h"
+#include "timer_wheel/s21_timer_wheel.h"
+#include "unrolled_list/s21_unrolled_list.h"
+#include "ws_deque/s21_ws_deque.h"
 
 #endif //CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H
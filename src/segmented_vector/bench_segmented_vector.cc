@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+
+#include "../bench/s21_bench.h"
+#include "../vector/s21_vector.h"
+#include "s21_segmented_vector.h"
+
+namespace {
+
+const int kReps = 5;
+
+struct record {
+  explicit record(std::uint64_t i) : id(i) {}
+  std::uint64_t id;
+  double values[7] = {};
+};
+
+// Total time to append n elements, then the slowest single push_back seen
+// while doing it (the relocation stall for s21::vector).
+template <class Container, class T>
+void append(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    Container c;
+    for (std::size_t i = 0; i < n; ++i) c.push_back(T{i});
+    s21::bench::do_not_optimize(c.size());
+  });
+  s21::bench::report(name, n, ns);
+
+  Container c;
+  double worst = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    c.push_back(T{i});
+    auto stop = std::chrono::steady_clock::now();
+    double push_ns =
+        std::chrono::duration<double, std::nano>(stop - start).count();
+    if (push_ns > worst) worst = push_ns;
+  }
+  std::printf("      worst single push_back: %.3f ms\n", worst / 1e6);
+}
+
+template <class Container>
+void scan(const char *name, Container &c) {
+  double ns = s21::bench::measure(kReps, [&c] {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < c.size(); ++i) sum += c[i];
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, c.size(), ns);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 20, std::size_t(1) << 24}) {
+    append<s21::vector<std::uint64_t>, std::uint64_t>(
+        "s21::vector<u64> push_back", n);
+    append<s21::segmented_vector<std::uint64_t>, std::uint64_t>(
+        "s21::segmented_vector<u64> push_back", n);
+  }
+  std::size_t n = std::size_t(1) << 21;
+  append<s21::vector<record>, record>("s21::vector<record> push_back", n);
+  append<s21::segmented_vector<record>, record>(
+      "s21::segmented_vector<record> push_back", n);
+
+  std::size_t scan_n = std::size_t(1) << 24;
+  s21::vector<std::uint64_t> v(scan_n);
+  s21::segmented_vector<std::uint64_t> s(scan_n);
+  std::iota(v.begin(), v.end(), 0);
+  std::iota(s.begin(), s.end(), 0);
+  scan("s21::vector<u64> indexed scan", v);
+  scan("s21::segmented_vector<u64> indexed scan", s);
+  double ns = s21::bench::measure(kReps, [&s] {
+    std::uint64_t sum = 0;
+    s.for_each_chunk([&sum](std::uint64_t *first, std::uint64_t *last) {
+      sum = std::accumulate(first, last, sum);
+    });
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report("s21::segmented_vector<u64> for_each_chunk", scan_n, ns);
+  return 0;
+}
@@ -0,0 +1,536 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SEGMENTED_VECTOR_H
+#define CPP2_S21_CONTAINERS_1_S21_SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+namespace internal {
+
+// Largest power of two number of T that fits in 4 KiB, at least one.
+template <class T>
+constexpr std::size_t default_chunk_size() {
+  std::size_t n = 1;
+  while (n * 2 * sizeof(T) <= 4096) n *= 2;
+  return n;
+}
+
+}  // namespace internal
+
+// A sequence stored as fixed-size chunks of ChunkSize elements reached
+// through an index table. Growing only adds chunks, so elements never move:
+// pointers and references stay valid until the element is popped or the
+// container is cleared. Iterators are invalidated by growth, as in
+// std::deque. Elements can only be added and removed at the back.
+template <class T, std::size_t ChunkSize = internal::default_chunk_size<T>(),
+          class Allocator = std::allocator<T>>
+class segmented_vector {
+  static_assert(ChunkSize != 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "segmented_vector chunk size must be a power of two");
+
+  template <bool Const>
+  class basic_iterator;
+
+ public:
+  //  Member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using size_type = size_t;
+
+  static constexpr size_type kChunkSize = ChunkSize;
+
+  //  Member functions
+  segmented_vector();
+  explicit segmented_vector(const Allocator &alloc);
+  segmented_vector(size_type n, const Allocator &alloc = Allocator());
+  segmented_vector(std::initializer_list<value_type> const &items,
+                   const Allocator &alloc = Allocator());
+  segmented_vector(const segmented_vector &v);
+  segmented_vector(segmented_vector &&v) noexcept;
+  ~segmented_vector();
+
+  segmented_vector &operator=(const segmented_vector &v);
+  segmented_vector &operator=(segmented_vector &&v) noexcept;
+
+  //  Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front();
+  const_reference back();
+  allocator_type get_allocator() const;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Chunk access
+  size_type chunk_count() const;
+  T *chunk_data(size_type chunk);
+  size_type chunk_size(size_type chunk) const;
+  // Calls fn(first, last) once per chunk with the chunk's live elements.
+  template <class Fn>
+  void for_each_chunk(Fn fn);
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+
+  //  Modifiers
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(segmented_vector &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  static constexpr size_type kShift = [] {
+    size_type shift = 0;
+    while ((size_type{1} << shift) < ChunkSize) ++shift;
+    return shift;
+  }();
+  static constexpr size_type kMask = ChunkSize - 1;
+
+  s21::vector<T *> chunks_;
+  size_type size_{};
+  Allocator alloc_{};
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  T *slot(size_type pos) const;
+  T *back_slot();
+  void release_chunks(size_type keep);
+};
+
+// Random-access iterator over the index table; dereferencing costs a shift
+// and a mask. for_each_chunk() avoids even that for linear scans.
+template <class T, std::size_t ChunkSize, class Allocator>
+template <bool Const>
+class segmented_vector<T, ChunkSize, Allocator>::basic_iterator {
+  using table_type = T *const *;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  basic_iterator() = default;
+  basic_iterator(table_type table, size_type index)
+      : table_(table), index_(index) {}
+  template <bool C = Const, class = std::enable_if_t<C>>
+  basic_iterator(const basic_iterator<false> &it)
+      : table_(it.table_), index_(it.index_) {}
+
+  reference operator*() const {
+    return table_[index_ >> kShift][index_ & kMask];
+  }
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  basic_iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+  basic_iterator operator++(int) {
+    basic_iterator old = *this;
+    ++index_;
+    return old;
+  }
+  basic_iterator &operator--() {
+    --index_;
+    return *this;
+  }
+  basic_iterator operator--(int) {
+    basic_iterator old = *this;
+    --index_;
+    return old;
+  }
+  basic_iterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  basic_iterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+  friend basic_iterator operator+(basic_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend basic_iterator operator+(difference_type n, basic_iterator it) {
+    return it += n;
+  }
+  friend basic_iterator operator-(basic_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const basic_iterator &a,
+                                   const basic_iterator &b) {
+    return static_cast<difference_type>(a.index_) -
+           static_cast<difference_type>(b.index_);
+  }
+
+  friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ == b.index_;
+  }
+  friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ != b.index_;
+  }
+  friend bool operator<(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ < b.index_;
+  }
+  friend bool operator>(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ > b.index_;
+  }
+  friend bool operator<=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ <= b.index_;
+  }
+  friend bool operator>=(const basic_iterator &a, const basic_iterator &b) {
+    return a.index_ >= b.index_;
+  }
+
+ private:
+  friend class basic_iterator<true>;
+
+  table_type table_{};
+  size_type index_{};
+};
+
+// CONSTRUCTOR
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector() = default;
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector(
+    const Allocator &alloc)
+    : alloc_(alloc) {}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector(
+    size_type n, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  resize(n);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector(
+    const std::initializer_list<value_type> &items, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector(
+    const segmented_vector &v)
+    : segmented_vector(
+          alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; ++i) push_back(v[i]);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::segmented_vector(
+    segmented_vector &&v) noexcept
+    : chunks_(std::move(v.chunks_)),
+      size_(std::exchange(v.size_, 0)),
+      alloc_(std::move(v.alloc_)) {}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator>::~segmented_vector() {
+  clear();
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator> &
+segmented_vector<T, ChunkSize, Allocator>::operator=(
+    const segmented_vector &v) {
+  if (this != &v) {
+    segmented_vector copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+segmented_vector<T, ChunkSize, Allocator> &
+segmented_vector<T, ChunkSize, Allocator>::operator=(
+    segmented_vector &&v) noexcept {
+  if (this != &v) {
+    clear();
+    swap(v);
+  }
+  return *this;
+}
+
+// Element access
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::reference
+segmented_vector<T, ChunkSize, Allocator>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::reference
+segmented_vector<T, ChunkSize, Allocator>::operator[](size_type pos) {
+  return *slot(pos);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+segmented_vector<T, ChunkSize, Allocator>::operator[](size_type pos) const {
+  return *slot(pos);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+segmented_vector<T, ChunkSize, Allocator>::front() {
+  return *slot(0);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+segmented_vector<T, ChunkSize, Allocator>::back() {
+  return *slot(size_ - 1);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::allocator_type
+segmented_vector<T, ChunkSize, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+// Iterators
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::iterator
+segmented_vector<T, ChunkSize, Allocator>::begin() {
+  return iterator(chunks_.data(), 0);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::iterator
+segmented_vector<T, ChunkSize, Allocator>::end() {
+  return iterator(chunks_.data(), size_);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::const_iterator
+segmented_vector<T, ChunkSize, Allocator>::begin() const {
+  return const_iterator(chunks_.data(), 0);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::const_iterator
+segmented_vector<T, ChunkSize, Allocator>::end() const {
+  return const_iterator(chunks_.data(), size_);
+}
+
+// Chunk access
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::size_type
+segmented_vector<T, ChunkSize, Allocator>::chunk_count() const {
+  return (size_ + kMask) >> kShift;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+T *segmented_vector<T, ChunkSize, Allocator>::chunk_data(size_type chunk) {
+  return chunks_[chunk];
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::size_type
+segmented_vector<T, ChunkSize, Allocator>::chunk_size(size_type chunk) const {
+  size_type first = chunk << kShift;
+  return size_ - first < ChunkSize ? size_ - first : ChunkSize;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <class Fn>
+void segmented_vector<T, ChunkSize, Allocator>::for_each_chunk(Fn fn) {
+  size_type chunks = chunk_count();
+  for (size_type c = 0; c < chunks; ++c) {
+    T *first = chunks_[c];
+    fn(first, first + chunk_size(c));
+  }
+}
+
+// Capacity
+
+template <class T, std::size_t ChunkSize, class Allocator>
+bool segmented_vector<T, ChunkSize, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::size_type
+segmented_vector<T, ChunkSize, Allocator>::size() const {
+  return size_;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::size_type
+segmented_vector<T, ChunkSize, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Too large size for a new capacity");
+  }
+  size_type needed = (size + kMask) >> kShift;
+  if (needed <= chunks_.size()) return;
+  chunks_.reserve(needed);
+  while (chunks_.size() < needed) {
+    chunks_.push_back(alloc_traits::allocate(alloc_, ChunkSize));
+  }
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename segmented_vector<T, ChunkSize, Allocator>::size_type
+segmented_vector<T, ChunkSize, Allocator>::capacity() const {
+  return chunks_.size() << kShift;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::shrink_to_fit() {
+  release_chunks(chunk_count());
+  chunks_.shrink_to_fit();
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::resize(size_type count) {
+  while (size_ > count) pop_back();
+  reserve(count);
+  while (size_ < count) emplace_back();
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::resize(
+    size_type count, const_reference value) {
+  while (size_ > count) pop_back();
+  reserve(count);
+  while (size_ < count) push_back(value);
+}
+
+// Modifiers
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::clear() {
+  for_each_chunk([this](T *first, T *last) {
+    for (; first != last; ++first) alloc_traits::destroy(alloc_, first);
+  });
+  size_ = 0;
+  release_chunks(0);
+  chunks_.clear();
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::push_back(
+    const_reference value) {
+  // Growth never moves existing elements, so value may alias one of them.
+  emplace_back(value);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <typename... Args>
+typename segmented_vector<T, ChunkSize, Allocator>::reference
+segmented_vector<T, ChunkSize, Allocator>::emplace_back(Args &&...args) {
+  T *p = back_slot();
+  alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+  ++size_;
+  return *p;
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::pop_back() {
+  --size_;
+  alloc_traits::destroy(alloc_, slot(size_));
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::swap(
+    segmented_vector &other) noexcept {
+  chunks_.swap(other.chunks_);
+  std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <typename... Args>
+void segmented_vector<T, ChunkSize, Allocator>::insert_many_back(
+    Args &&...args) {
+  reserve(size_ + sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// Storage
+
+template <class T, std::size_t ChunkSize, class Allocator>
+T *segmented_vector<T, ChunkSize, Allocator>::slot(size_type pos) const {
+  return chunks_[pos >> kShift] + (pos & kMask);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+T *segmented_vector<T, ChunkSize, Allocator>::back_slot() {
+  if ((size_ >> kShift) == chunks_.size()) {
+    T *chunk = alloc_traits::allocate(alloc_, ChunkSize);
+    try {
+      chunks_.push_back(chunk);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, chunk, ChunkSize);
+      throw;
+    }
+  }
+  return slot(size_);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void segmented_vector<T, ChunkSize, Allocator>::release_chunks(size_type keep) {
+  while (chunks_.size() > keep) {
+    alloc_traits::deallocate(alloc_, chunks_[chunks_.size() - 1], ChunkSize);
+    chunks_.pop_back();
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SEGMENTED_VECTOR_H
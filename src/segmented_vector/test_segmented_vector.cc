@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "s21_segmented_vector.h"
+
+TEST(segmented_vector_suite, default_chunk_size_is_a_page) {
+  EXPECT_EQ(s21::segmented_vector<char>::kChunkSize, static_cast<size_t>(4096));
+  EXPECT_EQ(s21::segmented_vector<double>::kChunkSize,
+            static_cast<size_t>(512));
+  struct big {
+    char bytes[5000];
+  };
+  EXPECT_EQ(s21::segmented_vector<big>::kChunkSize, static_cast<size_t>(1));
+}
+
+TEST(segmented_vector_suite, push_back_and_index) {
+  s21::segmented_vector<int, 8> v;
+  EXPECT_TRUE(v.empty());
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  EXPECT_EQ(v.size(), static_cast<size_t>(100));
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(104));
+  EXPECT_EQ(v.chunk_count(), static_cast<size_t>(13));
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(v[i], i);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_EQ(v.back(), 99);
+  EXPECT_THROW(v.at(100), std::out_of_range);
+}
+
+TEST(segmented_vector_suite, addresses_are_stable_across_growth) {
+  s21::segmented_vector<std::string, 4> v;
+  v.push_back("first");
+  std::string *first = &v[0];
+  std::string *fourth = nullptr;
+  for (int i = 1; i < 1000; ++i) {
+    v.push_back(std::to_string(i));
+    if (i == 3) fourth = &v[3];
+  }
+  EXPECT_EQ(first, &v[0]);
+  EXPECT_EQ(fourth, &v[3]);
+  EXPECT_EQ(*first, "first");
+  EXPECT_EQ(*fourth, "3");
+}
+
+TEST(segmented_vector_suite, push_back_of_own_element) {
+  s21::segmented_vector<std::string, 2> v = {"a", "b"};
+  v.push_back(v[0]);
+  v.push_back(std::move(v[1]));
+  EXPECT_EQ(v[2], "a");
+  EXPECT_EQ(v[3], "b");
+}
+
+TEST(segmented_vector_suite, iterators_are_random_access) {
+  s21::segmented_vector<int, 4> v;
+  for (int i = 0; i < 37; ++i) v.push_back(37 - i);
+  EXPECT_EQ(v.end() - v.begin(), 37);
+  std::sort(v.begin(), v.end());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+  EXPECT_EQ(*(v.begin() + 10), 11);
+  EXPECT_EQ(v.begin()[36], 37);
+
+  const s21::segmented_vector<int, 4> &cv = v;
+  s21::segmented_vector<int, 4>::const_iterator it = v.begin();
+  EXPECT_TRUE(it == cv.begin());
+  EXPECT_EQ(std::accumulate(cv.begin(), cv.end(), 0), 37 * 38 / 2);
+}
+
+TEST(segmented_vector_suite, for_each_chunk_visits_live_elements) {
+  s21::segmented_vector<int, 16> v(40);
+  std::iota(v.begin(), v.end(), 0);
+  size_t chunks = 0, total = 0;
+  long sum = 0;
+  v.for_each_chunk([&](int *first, int *last) {
+    ++chunks;
+    total += last - first;
+    sum = std::accumulate(first, last, sum);
+  });
+  EXPECT_EQ(chunks, static_cast<size_t>(3));
+  EXPECT_EQ(total, static_cast<size_t>(40));
+  EXPECT_EQ(sum, 40 * 39 / 2);
+  EXPECT_EQ(v.chunk_size(2), static_cast<size_t>(8));
+  EXPECT_EQ(v.chunk_data(1)[0], 16);
+}
+
+TEST(segmented_vector_suite, resize_pop_and_shrink) {
+  s21::segmented_vector<int, 8> v;
+  v.resize(20, 7);
+  EXPECT_EQ(v.size(), static_cast<size_t>(20));
+  EXPECT_EQ(v[19], 7);
+  v.resize(3);
+  EXPECT_EQ(v.size(), static_cast<size_t>(3));
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(24));
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(8));
+  v.pop_back();
+  EXPECT_EQ(v.back(), 7);
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(104));
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(0));
+}
+
+TEST(segmented_vector_suite, copy_move_and_swap) {
+  s21::segmented_vector<std::unique_ptr<int>, 2> owners;
+  owners.insert_many_back(std::make_unique<int>(1), std::make_unique<int>(2),
+                          std::make_unique<int>(3));
+  s21::segmented_vector<std::unique_ptr<int>, 2> moved(std::move(owners));
+  EXPECT_TRUE(owners.empty());
+  EXPECT_EQ(*moved[2], 3);
+
+  s21::segmented_vector<std::string, 2> a = {"x", "y", "z"};
+  s21::segmented_vector<std::string, 2> b(a);
+  b[0] = "changed";
+  EXPECT_EQ(a[0], "x");
+  s21::segmented_vector<std::string, 2> c;
+  c = b;
+  EXPECT_EQ(c[0], "changed");
+  c.swap(a);
+  EXPECT_EQ(c[0], "x");
+  EXPECT_EQ(a[0], "changed");
+  c = std::move(a);
+  EXPECT_EQ(c[2], "z");
+  EXPECT_EQ(c.size(), static_cast<size_t>(3));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
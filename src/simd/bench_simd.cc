@@ -0,0 +1,74 @@
+#include <cstdint>
+
+#include "../bench/s21_bench.h"
+#include "../vector/s21_vector.h"
+#include "s21_simd.h"
+
+namespace {
+
+const s21::simd::isa kLevels[] = {s21::simd::isa::scalar, s21::simd::isa::sse,
+                                  s21::simd::isa::avx2,
+                                  s21::simd::isa::avx512};
+
+// Prints one row: GB/s of op over n elements of T for each supported ISA.
+template <class T, class Op>
+void row(const char *op_name, const char *type_name, std::size_t n, Op op) {
+  s21::vector<T> a(n);
+  s21::vector<T> b(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = b[i] = static_cast<T>(i % 101);
+  }
+  int reps = n < 100000 ? 200 : 5;
+  std::printf("%-6s %-8s n=%-9zu", op_name, type_name, n);
+  for (s21::simd::isa level : kLevels) {
+    if (level > s21::simd::supported_isa()) break;
+    s21::simd::set_isa(level);
+    double ns = s21::bench::measure(reps, [&] { op(a, b); });
+    std::printf("  %s %7.2f", s21::simd::isa_name(level),
+                static_cast<double>(n * sizeof(T)) / ns);
+  }
+  std::printf("  GB/s\n");
+  s21::simd::set_isa(s21::simd::supported_isa());
+}
+
+template <class T>
+void type_rows(const char *type_name, std::size_t n) {
+  using V = s21::vector<T>;
+  row<T>("fill", type_name, n, [](V &a, V &) {
+    s21::simd::fill(a, T(7));
+    s21::bench::do_not_optimize(a.data());
+  });
+  row<T>("find", type_name, n, [](V &a, V &) {
+    s21::bench::do_not_optimize(s21::simd::find(a, T(127)));
+  });
+  row<T>("count", type_name, n, [](V &a, V &) {
+    s21::bench::do_not_optimize(s21::simd::count(a, T(3)));
+  });
+  row<T>("sum", type_name, n, [](V &a, V &) {
+    s21::bench::do_not_optimize(s21::simd::sum(a));
+  });
+  row<T>("min", type_name, n, [](V &a, V &) {
+    s21::bench::do_not_optimize(s21::simd::min(a));
+  });
+  row<T>("max", type_name, n, [](V &a, V &) {
+    s21::bench::do_not_optimize(s21::simd::max(a));
+  });
+  row<T>("equal", type_name, n, [](V &a, V &b) {
+    s21::bench::do_not_optimize(s21::simd::equal(a, b));
+  });
+}
+
+}  // namespace
+
+int main() {
+  std::printf("supported: %s\n",
+              s21::simd::isa_name(s21::simd::supported_isa()));
+  for (std::size_t n : {1024UL, 65536UL, 16777216UL}) {
+    type_rows<std::uint8_t>("uint8", n);
+    type_rows<std::int32_t>("int32", n);
+    type_rows<float>("float", n);
+    type_rows<std::int64_t>("int64", n);
+    type_rows<double>("double", n);
+  }
+  return 0;
+}
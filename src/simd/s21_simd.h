@@ -0,0 +1,627 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SIMD_H
+#define CPP2_S21_CONTAINERS_1_S21_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define S21_SIMD_VECTOR_EXTENSIONS 1
+#endif
+
+// Bulk algorithms over contiguous storage (s21::vector, s21::array, raw
+// pointers). Arithmetic element types run on the widest instruction set the
+// CPU supports, picked once at runtime: AVX-512, AVX2 or the 16-byte SSE2
+// baseline, with a plain loop as the fallback. The kernels are written once
+// with GCC vector extensions and instantiated per register width.
+namespace s21 {
+namespace simd {
+
+enum class isa { scalar, sse, avx2, avx512 };
+
+// Best level this CPU supports.
+inline isa supported_isa() {
+  static const isa level = [] {
+#ifdef S21_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+      return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) return isa::avx2;
+    return isa::sse;
+#elif defined(S21_SIMD_VECTOR_EXTENSIONS)
+    return isa::sse;
+#else
+    return isa::scalar;
+#endif
+  }();
+  return level;
+}
+
+namespace internal {
+
+inline isa &selected_isa() {
+  static isa level = supported_isa();
+  return level;
+}
+
+template <class T>
+using kernel_enabled =
+    std::bool_constant<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                       (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+                        sizeof(T) == 8)>;
+
+// Signed integer as wide as T: the lane type of comparison results.
+template <std::size_t Size>
+struct mask_lane;
+template <>
+struct mask_lane<1> {
+  using type = std::int8_t;
+};
+template <>
+struct mask_lane<2> {
+  using type = std::int16_t;
+};
+template <>
+struct mask_lane<4> {
+  using type = std::int32_t;
+};
+template <>
+struct mask_lane<8> {
+  using type = std::int64_t;
+};
+
+}  // namespace internal
+
+// Active level: supported_isa() unless lowered with set_isa(). Requests above
+// what the CPU supports are clamped.
+inline isa current_isa() { return internal::selected_isa(); }
+
+inline void set_isa(isa level) {
+  internal::selected_isa() = level < supported_isa() ? level : supported_isa();
+}
+
+inline const char *isa_name(isa level) {
+  switch (level) {
+    case isa::avx512:
+      return "avx512";
+    case isa::avx2:
+      return "avx2";
+    case isa::sse:
+      return "sse";
+    default:
+      return "scalar";
+  }
+}
+
+namespace internal {
+
+#ifdef S21_SIMD_VECTOR_EXTENSIONS
+
+#define S21_SIMD_INLINE [[gnu::always_inline]] static inline
+
+// Kernels are parameterized on the register width in bytes. They are only
+// ever inlined into the per-ISA entry points below, which is what lets the
+// compiler lower the generic vector code to zmm/ymm/xmm instructions.
+template <std::size_t Bytes>
+struct kernels {
+  template <class T>
+  struct lanes {
+    typedef T vec __attribute__((vector_size(Bytes)));
+    typedef typename mask_lane<sizeof(T)>::type lane;
+    typedef lane mask __attribute__((vector_size(Bytes)));
+    static constexpr std::size_t width = Bytes / sizeof(T);
+  };
+
+  // Vectors only travel by reference: passing them by value between
+  // functions compiled for different ISAs would change the calling ABI.
+  template <class V>
+  S21_SIMD_INLINE void load(V &v, const void *p) {
+    std::memcpy(&v, p, sizeof(V));
+  }
+
+  template <class M>
+  S21_SIMD_INLINE bool any(const M &m) {
+    typedef typename lanes<std::uint64_t>::vec words;
+    words bits = reinterpret_cast<const words &>(m);
+    std::uint64_t folded = 0;
+    for (std::size_t k = 0; k < Bytes / 8; ++k) folded |= bits[k];
+    return folded != 0;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE void fill(T *p, std::size_t n, T value) {
+    typedef typename lanes<T>::vec vec;
+    constexpr std::size_t w = lanes<T>::width;
+    vec v = vec{} + value;
+    std::size_t i = 0;
+    for (; i + w <= n; i += w) std::memcpy(p + i, &v, Bytes);
+    for (; i < n; ++i) p[i] = value;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE std::size_t find(const T *p, std::size_t n, T value) {
+    typedef typename lanes<T>::vec vec;
+    typedef typename lanes<T>::mask mask;
+    constexpr std::size_t w = lanes<T>::width;
+    vec key = vec{} + value;
+    std::size_t i = 0;
+    vec a, b, c, d;
+    for (; i + 4 * w <= n; i += 4 * w) {
+      load(a, p + i);
+      load(b, p + i + w);
+      load(c, p + i + 2 * w);
+      load(d, p + i + 3 * w);
+      // Lanes are 0 or -1, so the sum of four masks cannot wrap and is
+      // non-zero exactly where one matched. GCC 12 scalarizes `|` on AVX-512
+      // comparison results, `+` stays in registers.
+      mask hit = a == key;
+      mask hit_b = b == key;
+      mask hit_c = c == key;
+      mask hit_d = d == key;
+      hit += hit_b + hit_c + hit_d;
+      if (any(hit)) break;
+    }
+    for (; i + w <= n; i += w) {
+      load(a, p + i);
+      mask hit = a == key;
+      if (any(hit)) break;
+    }
+    for (; i < n; ++i) {
+      if (p[i] == value) return i;
+    }
+    return n;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE std::size_t count(const T *p, std::size_t n, T value) {
+    typedef typename lanes<T>::vec vec;
+    typedef typename lanes<T>::mask mask;
+    typedef typename lanes<T>::lane lane;
+    constexpr std::size_t w = lanes<T>::width;
+    // Matches are -1 lanes; fold them into size_t before a lane can wrap.
+    constexpr std::size_t lane_max =
+        static_cast<std::size_t>(std::numeric_limits<lane>::max());
+    constexpr std::size_t flush =
+        (lane_max < SIZE_MAX / w ? lane_max : SIZE_MAX / w) * w;
+    vec key = vec{} + value;
+    std::size_t total = 0;
+    std::size_t i = 0;
+    vec v;
+    while (i + w <= n) {
+      mask acc = {};
+      std::size_t stop = n - i > flush ? i + flush : n;
+      for (; i + w <= stop; i += w) {
+        load(v, p + i);
+        acc -= (v == key);
+      }
+      for (std::size_t k = 0; k < w; ++k) {
+        total += static_cast<std::size_t>(acc[k]);
+      }
+    }
+    for (; i < n; ++i) total += p[i] == value;
+    return total;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE T sum(const T *p, std::size_t n) {
+    typedef typename lanes<T>::vec vec;
+    constexpr std::size_t w = lanes<T>::width;
+    vec acc0 = {}, acc1 = {}, a, b;
+    std::size_t i = 0;
+    for (; i + 2 * w <= n; i += 2 * w) {
+      load(a, p + i);
+      load(b, p + i + w);
+      acc0 += a;
+      acc1 += b;
+    }
+    for (; i + w <= n; i += w) {
+      load(a, p + i);
+      acc0 += a;
+    }
+    acc0 += acc1;
+    T total = 0;
+    for (std::size_t k = 0; k < w; ++k) total += acc0[k];
+    for (; i < n; ++i) total += p[i];
+    return total;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE T min(const T *p, std::size_t n) {
+    typedef typename lanes<T>::vec vec;
+    constexpr std::size_t w = lanes<T>::width;
+    T best = p[0];
+    std::size_t i = 0;
+    if (n >= w) {
+      vec acc, v;
+      load(acc, p);
+      for (i = w; i + w <= n; i += w) {
+        load(v, p + i);
+        acc = v < acc ? v : acc;
+      }
+      for (std::size_t k = 0; k < w; ++k) best = acc[k] < best ? acc[k] : best;
+    }
+    for (; i < n; ++i) best = p[i] < best ? p[i] : best;
+    return best;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE T max(const T *p, std::size_t n) {
+    typedef typename lanes<T>::vec vec;
+    constexpr std::size_t w = lanes<T>::width;
+    T best = p[0];
+    std::size_t i = 0;
+    if (n >= w) {
+      vec acc, v;
+      load(acc, p);
+      for (i = w; i + w <= n; i += w) {
+        load(v, p + i);
+        acc = acc < v ? v : acc;
+      }
+      for (std::size_t k = 0; k < w; ++k) best = best < acc[k] ? acc[k] : best;
+    }
+    for (; i < n; ++i) best = best < p[i] ? p[i] : best;
+    return best;
+  }
+
+  template <class T>
+  S21_SIMD_INLINE bool equal(const T *a, const T *b, std::size_t n) {
+    typedef typename lanes<T>::vec vec;
+    typedef typename lanes<T>::mask mask;
+    constexpr std::size_t w = lanes<T>::width;
+    vec va, vb;
+    std::size_t i = 0;
+    for (; i + w <= n; i += w) {
+      load(va, a + i);
+      load(vb, b + i);
+      mask diff = va != vb;
+      if (any(diff)) return false;
+    }
+    for (; i < n; ++i) {
+      if (!(a[i] == b[i])) return false;
+    }
+    return true;
+  }
+
+  // Bit kernels over 64-bit words, for packed bitsets.
+  S21_SIMD_INLINE std::size_t popcount(const std::uint64_t *p, std::size_t n) {
+    // Four counters keep independent popcnt chains in flight.
+    std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      c0 += __builtin_popcountll(p[i]);
+      c1 += __builtin_popcountll(p[i + 1]);
+      c2 += __builtin_popcountll(p[i + 2]);
+      c3 += __builtin_popcountll(p[i + 3]);
+    }
+    for (; i < n; ++i) c0 += __builtin_popcountll(p[i]);
+    return c0 + c1 + c2 + c3;
+  }
+
+  template <char Op, class V>
+  S21_SIMD_INLINE void apply(V &a, const V &b) {
+    if constexpr (Op == '&') a &= b;
+    if constexpr (Op == '|') a |= b;
+    if constexpr (Op == '^') a ^= b;
+  }
+
+  template <char Op>
+  S21_SIMD_INLINE void bitwise(std::uint64_t *dst, const std::uint64_t *src,
+                               std::size_t n) {
+    typedef typename lanes<std::uint64_t>::vec vec;
+    constexpr std::size_t w = lanes<std::uint64_t>::width;
+    vec a, b;
+    std::size_t i = 0;
+    for (; i + w <= n; i += w) {
+      load(a, dst + i);
+      load(b, src + i);
+      apply<Op>(a, b);
+      std::memcpy(dst + i, &a, Bytes);
+    }
+    for (; i < n; ++i) apply<Op>(dst[i], src[i]);
+  }
+};
+
+// One entry point per instruction set; each inlines the kernel of its width.
+struct fill_op {
+  template <class K, class T>
+  S21_SIMD_INLINE void run(T *p, std::size_t n, T value) {
+    K::fill(p, n, value);
+  }
+};
+struct find_op {
+  template <class K, class T>
+  S21_SIMD_INLINE std::size_t run(const T *p, std::size_t n, T value) {
+    return K::find(p, n, value);
+  }
+};
+struct count_op {
+  template <class K, class T>
+  S21_SIMD_INLINE std::size_t run(const T *p, std::size_t n, T value) {
+    return K::count(p, n, value);
+  }
+};
+struct sum_op {
+  template <class K, class T>
+  S21_SIMD_INLINE T run(const T *p, std::size_t n) {
+    return K::sum(p, n);
+  }
+};
+struct min_op {
+  template <class K, class T>
+  S21_SIMD_INLINE T run(const T *p, std::size_t n) {
+    return K::min(p, n);
+  }
+};
+struct max_op {
+  template <class K, class T>
+  S21_SIMD_INLINE T run(const T *p, std::size_t n) {
+    return K::max(p, n);
+  }
+};
+struct equal_op {
+  template <class K, class T>
+  S21_SIMD_INLINE bool run(const T *a, const T *b, std::size_t n) {
+    return K::equal(a, b, n);
+  }
+};
+
+struct popcount_op {
+  template <class K>
+  S21_SIMD_INLINE std::size_t run(const std::uint64_t *p, std::size_t n) {
+    return K::popcount(p, n);
+  }
+};
+template <char Op>
+struct bitwise_op {
+  template <class K>
+  S21_SIMD_INLINE void run(std::uint64_t *dst, const std::uint64_t *src,
+                           std::size_t n) {
+    K::template bitwise<Op>(dst, src, n);
+  }
+};
+
+#undef S21_SIMD_INLINE
+
+template <class Op, class... Args>
+auto run_sse(Args... args) {
+  return Op::template run<kernels<16>>(args...);
+}
+
+#ifdef S21_SIMD_X86
+template <class Op, class... Args>
+__attribute__((target("avx2,popcnt"))) auto run_avx2(Args... args) {
+  return Op::template run<kernels<32>>(args...);
+}
+
+template <class Op, class... Args>
+__attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,popcnt"))) auto
+run_avx512(Args... args) {
+  return Op::template run<kernels<64>>(args...);
+}
+#endif
+
+template <class Op, class... Args>
+auto dispatch(Args... args) {
+#ifdef S21_SIMD_X86
+  switch (current_isa()) {
+    case isa::avx512:
+      return run_avx512<Op>(args...);
+    case isa::avx2:
+      return run_avx2<Op>(args...);
+    default:
+      break;
+  }
+#endif
+  return run_sse<Op>(args...);
+}
+
+#endif  // S21_SIMD_VECTOR_EXTENSIONS
+
+template <class T>
+bool use_kernels() {
+#ifdef S21_SIMD_VECTOR_EXTENSIONS
+  return kernel_enabled<T>::value && current_isa() != isa::scalar;
+#else
+  return false;
+#endif
+}
+
+}  // namespace internal
+
+////////////////////////////// Pointer interface //////////////////////////////
+
+template <class T>
+void fill(T *first, std::size_t n, const T &value) {
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::fill_op>(first, n, value);
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) first[i] = value;
+}
+
+// Index of the first element equal to value, or n.
+template <class T>
+std::size_t find(const T *first, std::size_t n, const T &value) {
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::find_op>(first, n, value);
+    }
+  }
+  std::size_t i = 0;
+  while (i < n && !(first[i] == value)) ++i;
+  return i;
+}
+
+template <class T>
+std::size_t count(const T *first, std::size_t n, const T &value) {
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::count_op>(first, n, value);
+    }
+  }
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < n; ++i) total += first[i] == value;
+  return total;
+}
+
+// Accumulates in T, so integer sums wrap like std::accumulate with a T init.
+// Floating-point sums are reassociated across lanes.
+template <class T>
+T sum(const T *first, std::size_t n) {
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::sum_op>(first, n);
+    }
+  }
+  T total = T();
+  for (std::size_t i = 0; i < n; ++i) total += first[i];
+  return total;
+}
+
+template <class T>
+T min(const T *first, std::size_t n) {
+  if (n == 0) {
+    throw std::invalid_argument("min of an empty range");
+  }
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::min_op>(first, n);
+    }
+  }
+  T best = first[0];
+  for (std::size_t i = 1; i < n; ++i) best = first[i] < best ? first[i] : best;
+  return best;
+}
+
+template <class T>
+T max(const T *first, std::size_t n) {
+  if (n == 0) {
+    throw std::invalid_argument("max of an empty range");
+  }
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::max_op>(first, n);
+    }
+  }
+  T best = first[0];
+  for (std::size_t i = 1; i < n; ++i) best = best < first[i] ? first[i] : best;
+  return best;
+}
+
+template <class T>
+bool equal(const T *a, const T *b, std::size_t n) {
+  if constexpr (internal::kernel_enabled<T>::value) {
+    if (internal::use_kernels<T>()) {
+      return internal::dispatch<internal::equal_op>(a, b, n);
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+// Number of set bits in n 64-bit words.
+inline std::size_t popcount(const std::uint64_t *words, std::size_t n) {
+#ifdef S21_SIMD_VECTOR_EXTENSIONS
+  if (current_isa() != isa::scalar) {
+    return internal::dispatch<internal::popcount_op>(words, n);
+  }
+#endif
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::uint64_t w = words[i]; w != 0; w &= w - 1) ++total;
+  }
+  return total;
+}
+
+namespace internal {
+
+// dst[i] = dst[i] Op src[i] for n 64-bit words; Op is '&', '|' or '^'.
+template <char Op, class Fn>
+void bitwise(std::uint64_t *dst, const std::uint64_t *src, std::size_t n,
+             Fn fn) {
+#ifdef S21_SIMD_VECTOR_EXTENSIONS
+  if (current_isa() != isa::scalar) {
+    return dispatch<bitwise_op<Op>>(dst, src, n);
+  }
+#endif
+  for (std::size_t i = 0; i < n; ++i) dst[i] = fn(dst[i], src[i]);
+}
+
+}  // namespace internal
+
+// dst[i] &= src[i] for n 64-bit words; bit_or and bit_xor likewise.
+inline void bit_and(std::uint64_t *dst, const std::uint64_t *src,
+                    std::size_t n) {
+  internal::bitwise<'&'>(dst, src, n, std::bit_and<>());
+}
+
+inline void bit_or(std::uint64_t *dst, const std::uint64_t *src,
+                   std::size_t n) {
+  internal::bitwise<'|'>(dst, src, n, std::bit_or<>());
+}
+
+inline void bit_xor(std::uint64_t *dst, const std::uint64_t *src,
+                    std::size_t n) {
+  internal::bitwise<'^'>(dst, src, n, std::bit_xor<>());
+}
+
+///////////////////////////// Container interface /////////////////////////////
+// Any container with contiguous data() and size(): s21::vector, s21::array,
+// s21::small_vector.
+
+template <class Container>
+void fill(Container &c, const typename Container::value_type &value) {
+  fill(c.data(), c.size(), value);
+}
+
+template <class Container>
+typename Container::iterator find(
+    Container &c, const typename Container::value_type &value) {
+  return c.begin() + find(c.data(), c.size(), value);
+}
+
+template <class Container>
+std::size_t count(Container &c, const typename Container::value_type &value) {
+  return count(c.data(), c.size(), value);
+}
+
+template <class Container>
+typename Container::value_type sum(Container &c) {
+  return sum(c.data(), c.size());
+}
+
+template <class Container>
+typename Container::value_type min(Container &c) {
+  return min(c.data(), c.size());
+}
+
+template <class Container>
+typename Container::value_type max(Container &c) {
+  return max(c.data(), c.size());
+}
+
+template <class Container>
+bool equal(Container &a, Container &b) {
+  return a.size() == b.size() && equal(a.data(), b.data(), a.size());
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SIMD_H
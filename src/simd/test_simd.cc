@@ -0,0 +1,150 @@
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "gtest/gtest.h"
+#include "s21_simd.h"
+
+namespace {
+
+const s21::simd::isa kLevels[] = {s21::simd::isa::scalar, s21::simd::isa::sse,
+                                  s21::simd::isa::avx2,
+                                  s21::simd::isa::avx512};
+
+// Runs check once per instruction set available on this machine.
+template <class Check>
+void for_each_isa(Check check) {
+  s21::simd::isa supported = s21::simd::supported_isa();
+  for (s21::simd::isa level : kLevels) {
+    if (level > supported) break;
+    s21::simd::set_isa(level);
+    SCOPED_TRACE(s21::simd::isa_name(level));
+    check();
+  }
+  s21::simd::set_isa(supported);
+}
+
+}  // namespace
+
+TEST(simd_suite, set_isa_clamps_to_supported) {
+  s21::simd::set_isa(s21::simd::isa::avx512);
+  EXPECT_EQ(s21::simd::current_isa(), s21::simd::supported_isa());
+  s21::simd::set_isa(s21::simd::isa::scalar);
+  EXPECT_EQ(s21::simd::current_isa(), s21::simd::isa::scalar);
+  s21::simd::set_isa(s21::simd::supported_isa());
+}
+
+TEST(simd_suite, fill_vector_and_array) {
+  for_each_isa([] {
+    s21::vector<float> v(37);
+    s21::simd::fill(v, 2.5f);
+    for (float x : v) EXPECT_EQ(x, 2.5f);
+
+    s21::array<std::int32_t, 67> a;
+    s21::simd::fill(a, -3);
+    EXPECT_EQ(s21::simd::count(a, -3), static_cast<size_t>(67));
+  });
+}
+
+TEST(simd_suite, find_every_position) {
+  for_each_isa([] {
+    s21::vector<std::int32_t> v(131);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<std::int32_t>(i);
+    for (size_t i = 0; i < v.size(); ++i) {
+      EXPECT_EQ(s21::simd::find(v, static_cast<std::int32_t>(i)),
+                v.begin() + i);
+    }
+    EXPECT_EQ(s21::simd::find(v, -1), v.end());
+  });
+}
+
+TEST(simd_suite, count_matches_std) {
+  for_each_isa([] {
+    std::vector<std::uint8_t> bytes(100000);
+    for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = i % 7;
+    EXPECT_EQ(s21::simd::count(bytes.data(), bytes.size(), std::uint8_t(3)),
+              static_cast<size_t>(std::count(bytes.begin(), bytes.end(), 3)));
+
+    s21::vector<double> v = {1.0, 2.0, 1.0, 1.0, 5.0};
+    EXPECT_EQ(s21::simd::count(v, 1.0), static_cast<size_t>(3));
+  });
+}
+
+TEST(simd_suite, sum_min_max) {
+  for_each_isa([] {
+    s21::vector<std::int32_t> v(1001);
+    for (size_t i = 0; i < v.size(); ++i) {
+      v[i] = static_cast<std::int32_t>(i) - 500;
+    }
+    v[777] = 9000;
+    v[3] = -9000;
+    std::int32_t expected = 0;
+    for (std::int32_t x : v) expected += x;
+
+    EXPECT_EQ(s21::simd::sum(v), expected);
+    EXPECT_EQ(s21::simd::min(v), -9000);
+    EXPECT_EQ(s21::simd::max(v), 9000);
+
+    s21::vector<float> f = {0.5f, 0.25f, 4.0f};
+    EXPECT_FLOAT_EQ(s21::simd::sum(f), 4.75f);
+    EXPECT_EQ(s21::simd::min(f), 0.25f);
+    EXPECT_EQ(s21::simd::max(f), 4.0f);
+  });
+}
+
+TEST(simd_suite, min_of_empty_throws) {
+  s21::vector<float> v;
+  EXPECT_THROW(s21::simd::min(v), std::invalid_argument);
+  EXPECT_THROW(s21::simd::max(v), std::invalid_argument);
+}
+
+TEST(simd_suite, equal) {
+  for_each_isa([] {
+    s21::vector<std::int64_t> a(100);
+    s21::vector<std::int64_t> b(100);
+    s21::simd::fill(a, std::int64_t(4));
+    s21::simd::fill(b, std::int64_t(4));
+    EXPECT_TRUE(s21::simd::equal(a, b));
+    b[99] = 5;
+    EXPECT_FALSE(s21::simd::equal(a, b));
+    b.pop_back();
+    EXPECT_FALSE(s21::simd::equal(a, b));
+  });
+}
+
+TEST(simd_suite, popcount_and_bitwise_words) {
+  for_each_isa([] {
+    s21::vector<std::uint64_t> a(37);
+    s21::vector<std::uint64_t> b(37);
+    for (size_t i = 0; i < a.size(); ++i) {
+      a[i] = 0x0123456789abcdefULL * (i + 1);
+      b[i] = ~a[i] ^ (i << 3);
+    }
+    size_t expected = 0;
+    for (std::uint64_t w : a) expected += std::bitset<64>(w).count();
+    EXPECT_EQ(s21::simd::popcount(a.data(), a.size()), expected);
+
+    s21::vector<std::uint64_t> x = a;
+    s21::simd::bit_and(x.data(), b.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) EXPECT_EQ(x[i], a[i] & b[i]);
+    x = a;
+    s21::simd::bit_or(x.data(), b.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) EXPECT_EQ(x[i], a[i] | b[i]);
+    x = a;
+    s21::simd::bit_xor(x.data(), b.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) EXPECT_EQ(x[i], a[i] ^ b[i]);
+  });
+}
+
+TEST(simd_suite, non_arithmetic_falls_back) {
+  s21::vector<std::string> v = {"a", "b", "a"};
+  EXPECT_EQ(s21::simd::count(v, std::string("a")), static_cast<size_t>(2));
+  EXPECT_EQ(s21::simd::find(v, std::string("b")), v.begin() + 1);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
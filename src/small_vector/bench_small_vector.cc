@@ -0,0 +1,43 @@
+#define S21_BENCH_COUNT_ALLOCATIONS
+
+#include <vector>
+
+#include "../bench/s21_bench.h"
+#include "s21_small_vector.h"
+
+namespace {
+
+const int kReps = 5;
+const std::size_t kRequests = 1000000;
+
+// Builds one short vector per simulated request, as a request handler would.
+template <class Vector>
+void run(const char *name, std::size_t length) {
+  s21::bench::allocations = 0;
+  double ns = s21::bench::measure(kReps, [length] {
+    for (std::size_t r = 0; r < kRequests; ++r) {
+      Vector v;
+      for (std::size_t i = 0; i < length; ++i) {
+        v.push_back(static_cast<int>(r + i));
+      }
+      s21::bench::do_not_optimize(v.data());
+    }
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s len=%zu", name, length);
+  s21::bench::report(label, kRequests, ns);
+  std::printf(
+      "      allocations per vector: %.2f\n",
+      static_cast<double>(s21::bench::allocations) / (kReps * kRequests));
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t length : {1UL, 4UL, 8UL, 16UL}) {
+    run<std::vector<int>>("std::vector<int>", length);
+    run<s21::vector<int>>("s21::vector<int>", length);
+    run<s21::small_vector<int, 8>>("s21::small_vector<int, 8>", length);
+  }
+  return 0;
+}
@@ -0,0 +1,541 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SMALL_VECTOR_H
+#define CPP2_S21_CONTAINERS_1_S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// A vector that keeps up to N elements inside the object itself and only
+// goes to Allocator once it outgrows them. Same interface as s21::vector.
+template <class T, std::size_t N, class Allocator = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "small_vector needs at least one inline element");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  //  Member functions
+  small_vector();
+  explicit small_vector(const Allocator &alloc);
+  small_vector(size_type n, const Allocator &alloc = Allocator());
+  small_vector(std::initializer_list<value_type> const &items,
+               const Allocator &alloc = Allocator());
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~small_vector();
+
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  //  Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  T *data();
+  allocator_type get_allocator() const;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  bool is_inline() const;
+
+  //  Modifiers
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  template <class ForwardIt>
+  iterator insert(iterator pos, ForwardIt first, ForwardIt last);
+  void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(small_vector &other);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  T *begin_;
+  size_type size_{};
+  size_type capacity_ = N;
+  Allocator alloc_{};
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  T *inline_data();
+  void release();
+  void steal(small_vector &v);
+  size_type next_capacity(size_type min_capacity);
+  void reallocate(size_type new_capacity);
+  template <typename... Args>
+  void realloc_append(Args &&...args);
+  template <class InputIt>
+  iterator insert_range(size_type index, InputIt first, size_type count);
+};
+
+// CONSTRUCTOR
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector() : begin_(inline_data()) {}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const Allocator &alloc)
+    : begin_(inline_data()), alloc_(alloc) {}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type n,
+                                            const Allocator &alloc)
+    : small_vector(alloc) {
+  reserve(n);
+  std::uninitialized_value_construct_n(begin_, n);
+  size_ = n;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(
+    const std::initializer_list<value_type> &items, const Allocator &alloc)
+    : small_vector(alloc) {
+  insert_range(0, items.begin(), items.size());
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &v)
+    : small_vector(alloc_traits::select_on_container_copy_construction(
+          v.alloc_)) {
+  insert_range(0, v.begin_, v.size_);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : begin_(inline_data()), alloc_(std::move(v.alloc_)) {
+  steal(v);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::~small_vector() {
+  release();
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::clear() {
+  release();
+  begin_ = inline_data();
+  capacity_ = N;
+  size_ = 0;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    const small_vector &v) {
+  if (this != &v) {
+    small_vector copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    small_vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  if (this != &v) {
+    clear();
+    alloc_ = std::move(v.alloc_);
+    steal(v);
+  }
+  return *this;
+}
+
+//  Element access
+
+template <class T, std::size_t N, class Allocator>
+T &small_vector<T, N, Allocator>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("out_of_range");
+  }
+  return begin_[pos];
+}
+
+template <class T, std::size_t N, class Allocator>
+T &small_vector<T, N, Allocator>::operator[](size_type pos) {
+  return begin_[pos];
+}
+
+template <class T, std::size_t N, class Allocator>
+const T &small_vector<T, N, Allocator>::operator[](size_type pos) const {
+  return begin_[pos];
+}
+
+template <class T, std::size_t N, class Allocator>
+const T &small_vector<T, N, Allocator>::front() const {
+  return begin_[0];
+}
+
+template <class T, std::size_t N, class Allocator>
+const T &small_vector<T, N, Allocator>::back() const {
+  return begin_[size_ - 1];
+}
+
+template <class T, std::size_t N, class Allocator>
+T *small_vector<T, N, Allocator>::data() {
+  return begin_;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::allocator_type
+small_vector<T, N, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+// Iterator
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::begin() {
+  return begin_;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::end() {
+  return begin_ + size_;
+}
+
+//  Capacity
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector<T, N, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::size() const {
+  return size_;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::max_size() const {
+  return std::min<size_type>(std::numeric_limits<size_type>::max() / sizeof(T),
+                             alloc_traits::max_size(alloc_));
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("length_error");
+  }
+  if (capacity_ < size) {
+    reallocate(size);
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::shrink_to_fit() {
+  if (!is_inline() && size_ != capacity_) {
+    reallocate(size_);
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector<T, N, Allocator>::is_inline() const {
+  return begin_ == reinterpret_cast<const T *>(buffer_);
+}
+
+// Modifiers
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(iterator pos, const_reference value) {
+  size_type index = pos - begin_;
+  if (pos == end()) {
+    push_back(value);
+  } else {
+    // value may refer to an element that is about to be shifted.
+    value_type copy(value);
+    insert_range(index, std::make_move_iterator(&copy), 1);
+  }
+  return begin_ + index;
+}
+
+template <class T, std::size_t N, class Allocator>
+template <class ForwardIt>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(iterator pos, ForwardIt first,
+                                      ForwardIt last) {
+  static_assert(
+      std::is_base_of_v<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<ForwardIt>::iterator_category>,
+      "insert requires forward iterators");
+  return insert_range(pos - begin_, first, std::distance(first, last));
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::erase(iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::erase(iterator first, iterator last) {
+  if (first != last) {
+    iterator new_end = std::move(last, end(), first);
+    std::destroy(new_end, end());
+    size_ = new_end - begin_;
+  }
+  return first;
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    realloc_append(value);
+  } else {
+    ::new (static_cast<void *>(begin_ + size_)) T(value);
+    size_++;
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::push_back(value_type &&value) {
+  if (size_ == capacity_) {
+    realloc_append(std::move(value));
+  } else {
+    ::new (static_cast<void *>(begin_ + size_)) T(std::move(value));
+    size_++;
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::pop_back() {
+  --size_;
+  std::destroy_at(begin_ + size_);
+}
+
+// Heap buffers trade pointers; inline elements have to be moved through a
+// temporary.
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector &other) {
+  if (this == &other) {
+    return;
+  }
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(begin_, other.begin_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(alloc_, other.alloc_);
+  } else {
+    small_vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+template <typename... Args>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert_many(const_iterator pos,
+                                           Args &&...args) {
+  size_type index = pos - begin_;
+  if constexpr (sizeof...(args) == 0) {
+    return begin_ + index;
+  } else {
+    T temp[] = {T(std::forward<Args>(args))...};
+    return insert_range(index, std::make_move_iterator(temp), sizeof...(args));
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+template <typename... Args>
+void small_vector<T, N, Allocator>::insert_many_back(Args &&...args) {
+  if constexpr (sizeof...(args) != 0) {
+    // Materialized first, so args may refer into the storage reserve() frees.
+    T temp[] = {T(std::forward<Args>(args))...};
+    if (size_ + sizeof...(args) > capacity_) {
+      reserve(next_capacity(size_ + sizeof...(args)));
+    }
+    std::uninitialized_move(std::begin(temp), std::end(temp), end());
+    size_ += sizeof...(args);
+  }
+}
+
+// Storage
+
+template <class T, std::size_t N, class Allocator>
+T *small_vector<T, N, Allocator>::inline_data() {
+  return reinterpret_cast<T *>(buffer_);
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::release() {
+  std::destroy(begin_, begin_ + size_);
+  if (!is_inline()) {
+    alloc_traits::deallocate(alloc_, begin_, capacity_);
+  }
+}
+
+// Takes over v's elements: its heap buffer if it has one, otherwise its
+// inline elements one by one. Leaves v empty and inline. *this must be empty
+// and inline.
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::steal(small_vector &v) {
+  if (v.is_inline()) {
+    uninitialized_relocate(v.begin_, v.begin_ + v.size_, begin_);
+    destroy_relocated(v.begin_, v.begin_ + v.size_);
+  } else {
+    begin_ = v.begin_;
+    capacity_ = v.capacity_;
+    v.begin_ = v.inline_data();
+    v.capacity_ = N;
+  }
+  size_ = v.size_;
+  v.size_ = 0;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::next_capacity(size_type min_capacity) {
+  if (min_capacity > max_size()) {
+    throw std::length_error("length_error");
+  }
+  size_type new_capacity = capacity_ * 2;
+  if (new_capacity < min_capacity || new_capacity > max_size()) {
+    new_capacity = min_capacity;
+  }
+  return new_capacity;
+}
+
+// Moves the elements to a heap block of new_capacity, or back inline when
+// they fit.
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::reallocate(size_type new_capacity) {
+  T *new_begin = new_capacity <= N
+                     ? inline_data()
+                     : alloc_traits::allocate(alloc_, new_capacity);
+  if (new_begin == begin_) {
+    return;
+  }
+  if (new_capacity <= N) {
+    new_capacity = N;
+  }
+  try {
+    uninitialized_relocate(begin_, begin_ + size_, new_begin);
+  } catch (...) {
+    if (new_begin != inline_data()) {
+      alloc_traits::deallocate(alloc_, new_begin, new_capacity);
+    }
+    throw;
+  }
+  destroy_relocated(begin_, begin_ + size_);
+  if (!is_inline()) {
+    alloc_traits::deallocate(alloc_, begin_, capacity_);
+  }
+  begin_ = new_begin;
+  capacity_ = new_capacity;
+}
+
+// The new element is built before the old ones move, so args may still refer
+// into the current storage.
+template <class T, std::size_t N, class Allocator>
+template <typename... Args>
+void small_vector<T, N, Allocator>::realloc_append(Args &&...args) {
+  size_type new_capacity = next_capacity(size_ + 1);
+  T *new_begin = alloc_traits::allocate(alloc_, new_capacity);
+  try {
+    ::new (static_cast<void *>(new_begin + size_))
+        T(std::forward<Args>(args)...);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, new_begin, new_capacity);
+    throw;
+  }
+  try {
+    uninitialized_relocate(begin_, begin_ + size_, new_begin);
+  } catch (...) {
+    std::destroy_at(new_begin + size_);
+    alloc_traits::deallocate(alloc_, new_begin, new_capacity);
+    throw;
+  }
+  destroy_relocated(begin_, begin_ + size_);
+  if (!is_inline()) {
+    alloc_traits::deallocate(alloc_, begin_, capacity_);
+  }
+  begin_ = new_begin;
+  capacity_ = new_capacity;
+  ++size_;
+}
+
+// Shares vector's insert helpers; only where the old block goes differs.
+template <class T, std::size_t N, class Allocator>
+template <class InputIt>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert_range(size_type index, InputIt first,
+                                            size_type count) {
+  if (count == 0) {
+    return begin_ + index;
+  }
+  if (size_ + count > capacity_) {
+    size_type new_capacity = next_capacity(size_ + count);
+    T *new_begin = alloc_traits::allocate(alloc_, new_capacity);
+    try {
+      internal::insert_relocating(begin_, size_, new_begin, index, first,
+                                  count);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, new_begin, new_capacity);
+      throw;
+    }
+    destroy_relocated(begin_, begin_ + size_);
+    if (!is_inline()) {
+      alloc_traits::deallocate(alloc_, begin_, capacity_);
+    }
+    begin_ = new_begin;
+    capacity_ = new_capacity;
+    size_ += count;
+  } else {
+    internal::insert_in_place(begin_, size_, index, first, count);
+  }
+  return begin_ + index;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SMALL_VECTOR_H
@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "s21_small_vector.h"
+
+TEST(small_vector_suite, starts_inline) {
+  s21::small_vector<int, 8> v;
+
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(8));
+}
+
+TEST(small_vector_suite, const_access) {
+  const s21::small_vector<int, 2> v({1, 2, 3});
+
+  EXPECT_FALSE(v.empty());
+  EXPECT_EQ(v.size(), static_cast<size_t>(3));
+  EXPECT_GE(v.capacity(), v.size());
+  EXPECT_GE(v.max_size(), v.capacity());
+  EXPECT_EQ(v[2], 3);
+}
+
+TEST(small_vector_suite, stays_inline_up_to_n) {
+  s21::small_vector<int, 4> v;
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(i);
+  }
+
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(8));
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(v[i], i);
+  }
+}
+
+TEST(small_vector_suite, matches_std_vector) {
+  s21::small_vector<std::string, 3> s21_a = {"a", "b"};
+  std::vector<std::string> std_a = {"a", "b"};
+
+  s21_a.insert(s21_a.begin() + 1, "c");
+  std_a.insert(std_a.begin() + 1, "c");
+  s21_a.insert_many(s21_a.begin(), std::string("d"), std::string("e"));
+  std_a.insert(std_a.begin(), {"d", "e"});
+  s21_a.insert_many_back(std::string("f"));
+  std_a.push_back("f");
+  s21_a.erase(s21_a.begin() + 2);
+  std_a.erase(std_a.begin() + 2);
+  s21_a.pop_back();
+  std_a.pop_back();
+
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+  EXPECT_EQ(s21_a.front(), std_a.front());
+  EXPECT_EQ(s21_a.back(), std_a.back());
+}
+
+TEST(small_vector_suite, range_insert_erase) {
+  s21::small_vector<int, 16> v = {1, 2, 3};
+  std::vector<int> src = {7, 8, 9};
+
+  v.insert(v.begin() + 1, src.begin(), src.end());
+  EXPECT_TRUE(v.is_inline());
+  v.erase(v.begin(), v.begin() + 2);
+
+  ASSERT_EQ(v.size(), static_cast<size_t>(4));
+  EXPECT_EQ(v[0], 8);
+  EXPECT_EQ(v[3], 3);
+}
+
+TEST(small_vector_suite, copy_and_move) {
+  s21::small_vector<std::string, 2> inline_v = {"x"};
+  s21::small_vector<std::string, 2> heap_v = {"a", "b", "c"};
+
+  s21::small_vector<std::string, 2> inline_copy(inline_v);
+  s21::small_vector<std::string, 2> heap_copy(heap_v);
+  EXPECT_EQ(inline_copy[0], "x");
+  EXPECT_EQ(heap_copy[2], "c");
+
+  std::string *heap_storage = heap_v.data();
+  s21::small_vector<std::string, 2> heap_moved(std::move(heap_v));
+  EXPECT_EQ(heap_moved.data(), heap_storage);
+  EXPECT_TRUE(heap_v.empty());
+  EXPECT_TRUE(heap_v.is_inline());
+
+  s21::small_vector<std::string, 2> inline_moved;
+  inline_moved = std::move(inline_v);
+  EXPECT_TRUE(inline_moved.is_inline());
+  EXPECT_EQ(inline_moved[0], "x");
+  EXPECT_TRUE(inline_v.empty());
+
+  inline_moved = heap_moved;
+  EXPECT_EQ(inline_moved.size(), static_cast<size_t>(3));
+}
+
+TEST(small_vector_suite, swap_inline_and_heap) {
+  s21::small_vector<int, 2> a = {1};
+  s21::small_vector<int, 2> b = {2, 3, 4};
+
+  a.swap(b);
+
+  ASSERT_EQ(a.size(), static_cast<size_t>(3));
+  ASSERT_EQ(b.size(), static_cast<size_t>(1));
+  EXPECT_EQ(a[2], 4);
+  EXPECT_EQ(b[0], 1);
+  EXPECT_TRUE(b.is_inline());
+}
+
+TEST(small_vector_suite, shrink_back_inline) {
+  s21::small_vector<int, 4> v = {1, 2, 3, 4, 5, 6};
+  v.erase(v.begin() + 2, v.end());
+  v.shrink_to_fit();
+
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), static_cast<size_t>(4));
+  EXPECT_EQ(v[1], 2);
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+}
+
+TEST(small_vector_suite, move_only_elements) {
+  s21::small_vector<std::unique_ptr<int>, 2> v;
+  for (int i = 0; i < 5; ++i) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  s21::small_vector<std::unique_ptr<int>, 2> w(std::move(v));
+
+  EXPECT_EQ(*w.back(), 4);
+  EXPECT_THROW(w.at(5), std::out_of_range);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
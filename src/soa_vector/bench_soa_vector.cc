@@ -0,0 +1,91 @@
+#include <cstdint>
+
+#include "../bench/s21_bench.h"
+#include "../simd/s21_simd.h"
+#include "../vector/s21_vector.h"
+#include "s21_soa_vector.h"
+
+namespace {
+
+const int kReps = 5;
+const std::size_t kRows = 4 * 1024 * 1024;
+
+// A 64-byte record of which the hot loop reads only price and quantity.
+struct record {
+  std::uint64_t id;
+  double price;
+  std::int32_t quantity;
+  std::int32_t flags;
+  double history[5];
+};
+
+using columns = s21::soa_vector<std::uint64_t, double, std::int32_t,
+                                std::int32_t, double, double, double, double,
+                                double>;
+
+}  // namespace
+
+int main() {
+  s21::vector<record> aos;
+  columns soa;
+  soa.reserve(kRows);
+  aos.reserve(kRows);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    double price = static_cast<double>(i % 1000) * 0.01;
+    std::int32_t quantity = static_cast<std::int32_t>(i % 7);
+    aos.push_back(record{i, price, quantity, 0, {0, 0, 0, 0, 0}});
+    soa.emplace_back(i, price, quantity, 0, 0.0, 0.0, 0.0, 0.0, 0.0);
+  }
+  std::printf("%zu rows of %zu bytes\n", kRows, sizeof(record));
+
+  s21::bench::report("AoS sum(price)", kRows,
+                     s21::bench::measure(kReps, [&aos] {
+                       double total = 0;
+                       for (std::size_t i = 0; i < kRows; ++i) {
+                         total += aos[i].price;
+                       }
+                       s21::bench::do_not_optimize(total);
+                     }));
+  s21::bench::report("SoA sum(price) loop", kRows,
+                     s21::bench::measure(kReps, [&soa] {
+                       const double *price = soa.data<1>();
+                       double total = 0;
+                       for (std::size_t i = 0; i < kRows; ++i) {
+                         total += price[i];
+                       }
+                       s21::bench::do_not_optimize(total);
+                     }));
+  s21::bench::report("SoA simd::sum(price)", kRows,
+                     s21::bench::measure(kReps, [&soa] {
+                       auto price = soa.column<1>();
+                       s21::bench::do_not_optimize(s21::simd::sum(price));
+                     }));
+  s21::bench::report("AoS sum(price * quantity)", kRows,
+                     s21::bench::measure(kReps, [&aos] {
+                       double total = 0;
+                       for (std::size_t i = 0; i < kRows; ++i) {
+                         total += aos[i].price * aos[i].quantity;
+                       }
+                       s21::bench::do_not_optimize(total);
+                     }));
+  s21::bench::report("SoA sum(price * quantity)", kRows,
+                     s21::bench::measure(kReps, [&soa] {
+                       const double *price = soa.data<1>();
+                       const std::int32_t *quantity = soa.data<2>();
+                       double total = 0;
+                       for (std::size_t i = 0; i < kRows; ++i) {
+                         total += price[i] * quantity[i];
+                       }
+                       s21::bench::do_not_optimize(total);
+                     }));
+  s21::bench::report("SoA row proxy sum(price * quantity)", kRows,
+                     s21::bench::measure(kReps, [&soa] {
+                       double total = 0;
+                       for (std::size_t i = 0; i < kRows; ++i) {
+                         auto row = soa[i];
+                         total += std::get<1>(row) * std::get<2>(row);
+                       }
+                       s21::bench::do_not_optimize(total);
+                     }));
+  return 0;
+}
@@ -0,0 +1,448 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SOA_VECTOR_H
+#define CPP2_S21_CONTAINERS_1_S21_SOA_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Contiguous view of one column; has the data()/size()/begin() shape that
+// s21::simd and the s21::parallel algorithms take.
+template <class T>
+class column_span {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using iterator = T *;
+  using size_type = size_t;
+
+  column_span(T *data, size_type size) : data_(data), size_(size) {}
+
+  T *data() const { return data_; }
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  iterator begin() const { return data_; }
+  iterator end() const { return data_ + size_; }
+  T &operator[](size_type pos) const { return data_[pos]; }
+
+ private:
+  T *data_;
+  size_type size_;
+};
+
+// Rows of Fields... stored column by column: each field lives in its own
+// s21::vector, so a loop over one field streams only that field's bytes.
+// Rows are read and written through tuples of references. All columns always
+// have the same size and capacity.
+template <class... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+  static_assert(!(std::is_same_v<Fields, bool> || ...),
+                "s21::vector<bool> is bit-packed and has no contiguous "
+                "column; store flags as std::uint8_t");
+
+  template <bool Const>
+  class row_iterator;
+
+ public:
+  //  Member type
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = row_iterator<false>;
+  using const_iterator = row_iterator<true>;
+  using size_type = size_t;
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_type kFields = sizeof...(Fields);
+
+  //  Member functions
+  soa_vector() = default;
+  explicit soa_vector(size_type n);
+  soa_vector(std::initializer_list<value_type> const &rows);
+
+  //  Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  reference back();
+
+  //  Column access
+  template <size_t I>
+  column_span<field_type<I>> column();
+  template <size_t I>
+  column_span<const field_type<I>> column() const;
+  template <size_t I>
+  field_type<I> *data();
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  void resize(size_type count);
+
+  //  Modifiers
+  void clear();
+  void push_back(const value_type &row);
+  void push_back(value_type &&row);
+  template <typename... Args>
+  reference emplace_back(Args &&...fields);
+  void pop_back();
+  void erase(iterator pos);
+  void swap(soa_vector &other);
+
+  template <typename... Rows>
+  void insert_many_back(Rows &&...rows);
+
+ private:
+  using indices = std::index_sequence_for<Fields...>;
+
+  std::tuple<s21::vector<Fields>...> columns_;
+
+  template <size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>);
+  template <size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const;
+  void grow_for(size_type count);
+  template <size_t... I>
+  void append(value_type &&row, std::index_sequence<I...>);
+};
+
+// Random-access iterator over rows; dereferences to a tuple of references.
+template <class... Fields>
+template <bool Const>
+class soa_vector<Fields...>::row_iterator {
+  using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename soa_vector::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference =
+      std::conditional_t<Const, typename soa_vector::const_reference,
+                         typename soa_vector::reference>;
+
+  row_iterator() = default;
+  row_iterator(owner *rows, size_type pos) : rows_(rows), pos_(pos) {}
+  template <bool C = Const, class = std::enable_if_t<C>>
+  row_iterator(const row_iterator<false> &it)
+      : rows_(it.rows_), pos_(it.pos_) {}
+
+  reference operator*() const { return (*rows_)[pos_]; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  row_iterator &operator++() {
+    ++pos_;
+    return *this;
+  }
+  row_iterator operator++(int) {
+    row_iterator old = *this;
+    ++pos_;
+    return old;
+  }
+  row_iterator &operator--() {
+    --pos_;
+    return *this;
+  }
+  row_iterator operator--(int) {
+    row_iterator old = *this;
+    --pos_;
+    return old;
+  }
+  row_iterator &operator+=(difference_type n) {
+    pos_ += n;
+    return *this;
+  }
+  row_iterator &operator-=(difference_type n) {
+    pos_ -= n;
+    return *this;
+  }
+  friend row_iterator operator+(row_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend row_iterator operator+(difference_type n, row_iterator it) {
+    return it += n;
+  }
+  friend row_iterator operator-(row_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const row_iterator &a,
+                                   const row_iterator &b) {
+    return static_cast<difference_type>(a.pos_) -
+           static_cast<difference_type>(b.pos_);
+  }
+  friend bool operator==(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ == b.pos_;
+  }
+  friend bool operator!=(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ != b.pos_;
+  }
+  friend bool operator<(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ < b.pos_;
+  }
+  friend bool operator>(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ > b.pos_;
+  }
+  friend bool operator<=(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ <= b.pos_;
+  }
+  friend bool operator>=(const row_iterator &a, const row_iterator &b) {
+    return a.pos_ >= b.pos_;
+  }
+
+  size_type index() const { return pos_; }
+
+ private:
+  friend class row_iterator<true>;
+
+  owner *rows_{};
+  size_type pos_{};
+};
+
+// CONSTRUCTOR
+
+template <class... Fields>
+soa_vector<Fields...>::soa_vector(size_type n)
+    : columns_(s21::vector<Fields>(n)...) {}
+
+template <class... Fields>
+soa_vector<Fields...>::soa_vector(
+    const std::initializer_list<value_type> &rows) {
+  reserve(rows.size());
+  for (const value_type &r : rows) push_back(r);
+}
+
+// Element access
+
+template <class... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(
+    size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return row(pos, indices());
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](
+    size_type pos) {
+  return row(pos, indices());
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::operator[](size_type pos) const {
+  return row(pos, indices());
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::front() {
+  return row(0, indices());
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::back() {
+  return row(size() - 1, indices());
+}
+
+// Column access
+
+template <class... Fields>
+template <size_t I>
+column_span<typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() {
+  auto &c = std::get<I>(columns_);
+  return {c.data(), c.size()};
+}
+
+template <class... Fields>
+template <size_t I>
+column_span<const typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() const {
+  auto &c = std::get<I>(columns_);
+  return {c.data(), c.size()};
+}
+
+template <class... Fields>
+template <size_t I>
+typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::data() {
+  return std::get<I>(columns_).data();
+}
+
+// Iterators
+
+template <class... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::begin() {
+  return iterator(this, 0);
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::end() {
+  return iterator(this, size());
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::begin()
+    const {
+  return const_iterator(this, 0);
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::end()
+    const {
+  return const_iterator(this, size());
+}
+
+// Capacity
+
+template <class... Fields>
+bool soa_vector<Fields...>::empty() const {
+  return size() == 0;
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::size() const {
+  return std::get<0>(columns_).size();
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::reserve(size_type size) {
+  std::apply([size](auto &...c) { (c.reserve(size), ...); }, columns_);
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::capacity()
+    const {
+  return std::get<0>(columns_).capacity();
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::shrink_to_fit() {
+  std::apply([](auto &...c) { (c.shrink_to_fit(), ...); }, columns_);
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::resize(size_type count) {
+  std::apply([count](auto &...c) { (c.resize(count), ...); }, columns_);
+}
+
+// Modifiers
+
+template <class... Fields>
+void soa_vector<Fields...>::clear() {
+  std::apply([](auto &...c) { (c.clear(), ...); }, columns_);
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::push_back(const value_type &row) {
+  append(value_type(row), indices());
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::push_back(value_type &&row) {
+  append(std::move(row), indices());
+}
+
+template <class... Fields>
+template <typename... Args>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::emplace_back(
+    Args &&...fields) {
+  static_assert(sizeof...(Args) == kFields,
+                "emplace_back takes one value per field");
+  // Built first, so fields may refer into the columns that growth moves.
+  append(value_type(std::forward<Args>(fields)...), indices());
+  return back();
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::pop_back() {
+  std::apply([](auto &...c) { (c.pop_back(), ...); }, columns_);
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::erase(iterator pos) {
+  size_type index = pos.index();
+  std::apply([index](auto &...c) { (c.erase(c.begin() + index), ...); },
+             columns_);
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::swap(soa_vector &other) {
+  std::apply(
+      [&other](auto &...c) {
+        std::apply([&c...](auto &...o) { (c.swap(o), ...); }, other.columns_);
+      },
+      columns_);
+}
+
+template <class... Fields>
+template <typename... Rows>
+void soa_vector<Fields...>::insert_many_back(Rows &&...rows) {
+  grow_for(size() + sizeof...(rows));
+  (push_back(value_type(std::forward<Rows>(rows))), ...);
+}
+
+// Storage
+
+template <class... Fields>
+template <size_t... I>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::row(
+    size_type pos, std::index_sequence<I...>) {
+  return reference(std::get<I>(columns_)[pos]...);
+}
+
+template <class... Fields>
+template <size_t... I>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::row(
+    size_type pos, std::index_sequence<I...>) const {
+  return const_reference(std::get<I>(columns_)[pos]...);
+}
+
+// Grows every column to the same doubled capacity at once, so the appends
+// that follow cannot reallocate one column and then fail on another.
+template <class... Fields>
+void soa_vector<Fields...>::grow_for(size_type count) {
+  size_type cap = capacity();
+  if (count > cap) {
+    reserve(cap * 2 > count ? cap * 2 : count);
+  }
+}
+
+// Moves each field of row onto its column. If a move throws, the columns
+// already extended are popped again so the row is all or nothing.
+template <class... Fields>
+template <size_t... I>
+void soa_vector<Fields...>::append(value_type &&row,
+                                   std::index_sequence<I...>) {
+  grow_for(size() + 1);
+  size_type done = 0;
+  try {
+    ((std::get<I>(columns_).push_back(std::move(std::get<I>(row))), ++done),
+     ...);
+  } catch (...) {
+    ((I < done ? std::get<I>(columns_).pop_back() : void()), ...);
+    throw;
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SOA_VECTOR_H
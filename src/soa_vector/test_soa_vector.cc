@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "../simd/s21_simd.h"
+#include "../test/s21_test.h"
+#include "gtest/gtest.h"
+#include "s21_soa_vector.h"
+
+namespace {
+
+using table = s21::soa_vector<std::int64_t, double, std::string>;
+using s21::test::fragile;
+
+}  // namespace
+
+TEST(soa_vector_suite, push_back_and_rows) {
+  table t;
+  EXPECT_TRUE(t.empty());
+  t.push_back({1, 1.5, "one"});
+  t.emplace_back(2, 2.5, "two");
+  std::tuple<std::int64_t, double, std::string> row(3, 3.5, "three");
+  t.push_back(row);
+  EXPECT_EQ(t.size(), static_cast<size_t>(3));
+  EXPECT_EQ(std::get<2>(t[1]), "two");
+  EXPECT_EQ(std::get<0>(t.back()), 3);
+  EXPECT_THROW(t.at(3), std::out_of_range);
+
+  auto [id, price, name] = t[0];
+  id = 10;
+  price = 0.25;
+  name = "ten";
+  EXPECT_EQ(std::get<0>(t.front()), 10);
+  EXPECT_EQ(std::get<1>(t[0]), 0.25);
+  EXPECT_EQ(std::get<2>(t[0]), "ten");
+
+  table::value_type copy = t[2];
+  std::get<2>(t[2]) = "changed";
+  EXPECT_EQ(std::get<2>(copy), "three");
+}
+
+TEST(soa_vector_suite, columns_are_contiguous) {
+  s21::soa_vector<std::int32_t, float> t;
+  for (int i = 0; i < 100; ++i) t.emplace_back(i, i * 0.5f);
+  auto ids = t.column<0>();
+  auto values = t.column<1>();
+  EXPECT_EQ(ids.size(), static_cast<size_t>(100));
+  EXPECT_EQ(ids.data(), t.data<0>());
+  EXPECT_EQ(ids.data() + 99, &std::get<0>(t[99]));
+  EXPECT_EQ(s21::simd::sum(ids), 4950);
+  EXPECT_EQ(s21::simd::max(values), 49.5f);
+  EXPECT_EQ(s21::simd::find(ids, 42), ids.begin() + 42);
+
+  const auto &ct = t;
+  EXPECT_EQ(std::accumulate(ct.column<1>().begin(), ct.column<1>().end(), 0.0f),
+            2475.0f);
+}
+
+TEST(soa_vector_suite, insert_many_back_and_capacity) {
+  table t;
+  t.insert_many_back(table::value_type(1, 1.0, "a"),
+                     table::value_type(2, 2.0, "b"),
+                     table::value_type(3, 3.0, "c"));
+  EXPECT_EQ(t.size(), static_cast<size_t>(3));
+  EXPECT_EQ(t.capacity(), static_cast<size_t>(3));
+  t.push_back({4, 4.0, "d"});
+  EXPECT_EQ(t.capacity(), static_cast<size_t>(6));
+  EXPECT_EQ(t.column<2>().size(), static_cast<size_t>(4));
+  t.reserve(50);
+  EXPECT_EQ(t.capacity(), static_cast<size_t>(50));
+  t.shrink_to_fit();
+  EXPECT_EQ(t.capacity(), static_cast<size_t>(4));
+}
+
+TEST(soa_vector_suite, emplace_from_own_row) {
+  s21::soa_vector<std::string, int> t;
+  t.emplace_back("first", 1);
+  for (int i = 0; i < 20; ++i) {
+    t.emplace_back(std::get<0>(t[0]), std::get<1>(t[0]) + i);
+  }
+  EXPECT_EQ(std::get<0>(t[20]), "first");
+  EXPECT_EQ(std::get<1>(t[20]), 20);
+}
+
+TEST(soa_vector_suite, row_iterators_and_sort_by_column) {
+  s21::soa_vector<int, char> t = {{3, 'c'}, {1, 'a'}, {2, 'b'}};
+  int sum = 0;
+  for (auto [id, tag] : t) {
+    sum += id;
+    tag = static_cast<char>(tag - 'a' + 'A');
+  }
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(t.end() - t.begin(), 3);
+  EXPECT_EQ(std::get<1>(*(t.begin() + 2)), 'B');
+
+  const auto &ct = t;
+  auto it = std::find_if(ct.begin(), ct.end(),
+                         [](auto row) { return std::get<0>(row) == 1; });
+  EXPECT_EQ(it.index(), static_cast<size_t>(1));
+
+  s21::soa_vector<int, char> sorted = {{1, 'a'}, {3, 'b'}, {5, 'c'}, {7, 'd'}};
+  auto first = sorted.begin();
+  auto last = 4 + first;
+  EXPECT_TRUE(last == sorted.end());
+  EXPECT_TRUE(last > first && first < last);
+  EXPECT_TRUE(first <= first && last >= first && !(first >= last));
+  auto found = std::partition_point(first, last, [](auto row) {
+    return std::get<0>(row) < 5;
+  });
+  EXPECT_EQ(found.index(), static_cast<size_t>(2));
+  EXPECT_EQ(std::distance(first, found), 2);
+  std::advance(found, -2);
+  EXPECT_TRUE(found == first);
+}
+
+TEST(soa_vector_suite, pop_erase_resize_clear) {
+  table t;
+  for (int i = 0; i < 5; ++i) t.emplace_back(i, i * 1.0, std::to_string(i));
+  t.pop_back();
+  t.erase(t.begin() + 1);
+  EXPECT_EQ(t.size(), static_cast<size_t>(3));
+  EXPECT_EQ(std::get<2>(t[1]), "2");
+  t.resize(6);
+  EXPECT_EQ(std::get<0>(t[5]), 0);
+  EXPECT_EQ(std::get<2>(t[5]), "");
+  t.clear();
+  EXPECT_TRUE(t.empty());
+  EXPECT_TRUE(t.column<1>().empty());
+}
+
+TEST(soa_vector_suite, copy_move_swap) {
+  table a = {{1, 1.0, "x"}};
+  table b(a);
+  std::get<2>(b[0]) = "y";
+  EXPECT_EQ(std::get<2>(a[0]), "x");
+  table c(std::move(b));
+  EXPECT_EQ(std::get<2>(c[0]), "y");
+  a.swap(c);
+  EXPECT_EQ(std::get<2>(a[0]), "y");
+  EXPECT_EQ(std::get<2>(c[0]), "x");
+  table d(4);
+  EXPECT_EQ(d.size(), static_cast<size_t>(4));
+}
+
+TEST(soa_vector_suite, failed_append_leaves_columns_equal) {
+  s21::soa_vector<int, fragile> t;
+  t.reserve(4);
+  t.emplace_back(1, fragile());
+  fragile::copies_left = 0;
+  EXPECT_THROW(t.push_back({2, fragile()}), std::runtime_error);
+  fragile::copies_left = -1;
+  EXPECT_EQ(t.size(), static_cast<size_t>(1));
+  EXPECT_EQ(t.column<0>().size(), t.column<1>().size());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "../bench/s21_bench.h"
+#include "../queue/s21_queue.h"
+#include "s21_spsc_queue.h"
+
+namespace {
+
+const int kReps = 3;
+const std::size_t kCapacity = 1024;
+
+// The baseline this replaces: s21::queue behind one mutex, bounded to the
+// same capacity so both sides see the same back-pressure.
+class locked_queue {
+ public:
+  bool try_push(std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == kCapacity) return false;
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(std::uint64_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<std::uint64_t> queue_;
+};
+
+using ring = s21::spsc_queue<std::uint64_t, kCapacity>;
+
+// Spins politely; the machine may have fewer cores than threads.
+template <class Fn>
+void until(Fn fn) {
+  while (!fn()) std::this_thread::yield();
+}
+
+template <class Queue>
+void throughput(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    auto q = std::make_unique<Queue>();
+    std::thread producer([&q, n] {
+      for (std::uint64_t i = 0; i < n; ++i) {
+        until([&] { return q->try_push(i); });
+      }
+    });
+    std::uint64_t sum = 0, value = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      until([&] { return q->try_pop(value); });
+      sum += value;
+    }
+    producer.join();
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, n, ns);
+}
+
+void batched_throughput(const char *name, std::size_t batch, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [batch, n] {
+    auto q = std::make_unique<ring>();
+    std::thread producer([&q, batch, n] {
+      std::uint64_t buffer[256];
+      for (std::uint64_t i = 0; i < n;) {
+        std::size_t k = 0;
+        for (; k < batch && i + k < n; ++k) buffer[k] = i + k;
+        std::size_t sent = q->push_n(buffer, k);
+        if (sent == 0) std::this_thread::yield();
+        i += sent;
+      }
+    });
+    std::uint64_t sum = 0, buffer[256];
+    for (std::size_t got = 0; got < n;) {
+      std::size_t k = q->pop_n(buffer, batch);
+      if (k == 0) std::this_thread::yield();
+      for (std::size_t j = 0; j < k; ++j) sum += buffer[j];
+      got += k;
+    }
+    producer.join();
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, n, ns);
+}
+
+// Round trip through a pair of queues: one message in flight at a time.
+template <class Queue>
+void ping_pong(const char *name, std::size_t rounds) {
+  double ns = s21::bench::measure(kReps, [rounds] {
+    auto there = std::make_unique<Queue>();
+    auto back = std::make_unique<Queue>();
+    std::thread echo([&there, &back, rounds] {
+      std::uint64_t value = 0;
+      for (std::size_t i = 0; i < rounds; ++i) {
+        until([&] { return there->try_pop(value); });
+        until([&] { return back->try_push(value + 1); });
+      }
+    });
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < rounds; ++i) {
+      until([&] { return there->try_push(value); });
+      until([&] { return back->try_pop(value); });
+    }
+    echo.join();
+    s21::bench::do_not_optimize(value);
+  });
+  s21::bench::report(name, rounds, ns);
+}
+
+}  // namespace
+
+int main() {
+  std::size_t n = std::size_t(1) << 22;
+  throughput<locked_queue>("mutex + s21::queue throughput", n);
+  throughput<ring>("s21::spsc_queue throughput", n);
+  batched_throughput("s21::spsc_queue push_n/pop_n (64)", 64, n);
+  std::size_t rounds = std::size_t(1) << 16;
+  ping_pong<locked_queue>("mutex + s21::queue round trip", rounds);
+  ping_pong<ring>("s21::spsc_queue round trip", rounds);
+  return 0;
+}
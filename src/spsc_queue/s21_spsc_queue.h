@@ -0,0 +1,215 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SPSC_QUEUE_H
+#define CPP2_S21_CONTAINERS_1_S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Bounded FIFO between exactly one producer thread and one consumer thread.
+// Each side owns one index and only reads the other's, with acquire/release
+// ordering and no locks or CAS loops, so every operation is wait-free. The
+// indices sit on separate cache lines, and each side keeps a private copy of
+// the other's index that it refreshes only when the queue looks full (or
+// empty), so in steady state the two threads do not share any line except
+// the slots themselves. The slots are stored inline; allocate large queues
+// on the heap.
+template <class T, std::size_t Capacity>
+class spsc_queue {
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using size_type = size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+  //  Member functions
+  spsc_queue() = default;
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue();
+
+  //  Capacity
+  // Both are snapshots; exact only on a thread that the other side is not
+  // running against.
+  bool empty() const;
+  size_type size() const;
+  static constexpr size_type capacity() { return Capacity; }
+
+  //  Producer side. Each returns false (or a short count) when full.
+  bool try_push(const T &value);
+  bool try_push(T &&value);
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  // Copies up to n elements from first and publishes them all at once.
+  // Returns how many fit.
+  template <class InputIt>
+  size_type push_n(InputIt first, size_type n);
+
+  //  Consumer side. Each returns false (or a short count) when empty.
+  bool try_pop(T &value);
+  // Moves up to n elements to out and releases their slots all at once.
+  // Returns how many there were.
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type n);
+
+ private:
+  static constexpr size_type kMask = Capacity - 1;
+
+  T *slot(size_type index);
+  size_type free_slots(size_type tail, size_type wanted);
+  size_type ready_slots(size_type head, size_type wanted);
+
+  // Consumer line: the next index to pop, and the producer's last seen tail.
+  alignas(kCacheLine) std::atomic<size_type> head_{0};
+  size_type cached_tail_ = 0;
+  // Producer line: the next index to push, and the consumer's last seen head.
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};
+  size_type cached_head_ = 0;
+  alignas(kCacheLine) alignas(T) unsigned char storage_[sizeof(T) * Capacity];
+};
+
+// CONSTRUCTOR
+
+template <class T, std::size_t Capacity>
+spsc_queue<T, Capacity>::~spsc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    slot(i)->~T();
+  }
+}
+
+// Capacity
+
+template <class T, std::size_t Capacity>
+bool spsc_queue<T, Capacity>::empty() const {
+  return size() == 0;
+}
+
+template <class T, std::size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::size()
+    const {
+  size_type head = head_.load(std::memory_order_acquire);
+  return tail_.load(std::memory_order_acquire) - head;
+}
+
+// Producer side
+
+template <class T, std::size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(const T &value) {
+  return try_emplace(value);
+}
+
+template <class T, std::size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(T &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <class T, std::size_t Capacity>
+template <typename... Args>
+bool spsc_queue<T, Capacity>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_slots(tail, 1) == 0) return false;
+  ::new (static_cast<void *>(slot(tail))) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+template <class InputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::push_n(
+    InputIt first, size_type n) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type count = free_slots(tail, n);
+  size_type built = 0;
+  try {
+    for (; built < count; ++built, ++first) {
+      ::new (static_cast<void *>(slot(tail + built))) T(*first);
+    }
+  } catch (...) {
+    // Nothing was published yet, so the consumer never saw these.
+    while (built != 0) slot(tail + --built)->~T();
+    throw;
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+// Consumer side
+
+template <class T, std::size_t Capacity>
+bool spsc_queue<T, Capacity>::try_pop(T &value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ready_slots(head, 1) == 0) return false;
+  T *p = slot(head);
+  value = std::move(*p);
+  p->~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+template <class OutputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::pop_n(
+    OutputIt out, size_type n) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type count = ready_slots(head, n);
+  size_type done = 0;
+  try {
+    for (; done < count; ++done, ++out) {
+      T *p = slot(head + done);
+      *out = std::move(*p);
+      p->~T();
+    }
+  } catch (...) {
+    // Hands back the slots already emptied; the failed one stays queued.
+    head_.store(head + done, std::memory_order_release);
+    throw;
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+// Storage
+
+template <class T, std::size_t Capacity>
+T *spsc_queue<T, Capacity>::slot(size_type index) {
+  return std::launder(
+      reinterpret_cast<T *>(storage_ + (index & kMask) * sizeof(T)));
+}
+
+// Room for up to wanted more elements past tail. The consumer's head is read
+// (one cache miss) only when the cached copy says there is not enough room.
+template <class T, std::size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::free_slots(size_type tail, size_type wanted) {
+  size_type room = Capacity - (tail - cached_head_);
+  if (room < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    room = Capacity - (tail - cached_head_);
+  }
+  return room < wanted ? room : wanted;
+}
+
+// Published elements from head on, up to wanted; refreshes the cached tail
+// the same way.
+template <class T, std::size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::ready_slots(size_type head, size_type wanted) {
+  size_type ready = cached_tail_ - head;
+  if (ready < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    ready = cached_tail_ - head;
+  }
+  return ready < wanted ? ready : wanted;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SPSC_QUEUE_H
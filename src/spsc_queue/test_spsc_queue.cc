@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test/s21_test.h"
+#include "gtest/gtest.h"
+#include "s21_spsc_queue.h"
+
+using s21::test::fragile;
+using s21::test::tracked;
+
+TEST(spsc_queue_suite, fifo_full_and_empty) {
+  s21::spsc_queue<int, 4> q;
+  static_assert(alignof(s21::spsc_queue<int, 4>) >= 64);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.capacity(), static_cast<size_t>(4));
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(4));
+  EXPECT_EQ(q.size(), static_cast<size_t>(4));
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(spsc_queue_suite, wraps_around) {
+  s21::spsc_queue<std::string, 8> q;
+  std::string value;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(q.try_emplace(3, static_cast<char>('a' + i % 26)));
+    if (i >= 5) {
+      ASSERT_TRUE(q.try_pop(value));
+      EXPECT_EQ(value, std::string(3, static_cast<char>('a' + (i - 5) % 26)));
+    }
+  }
+  EXPECT_EQ(q.size(), static_cast<size_t>(5));
+}
+
+TEST(spsc_queue_suite, batches_stop_at_capacity) {
+  s21::spsc_queue<int, 8> q;
+  std::vector<int> in = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.push_n(in.begin(), in.size()), static_cast<size_t>(8));
+  EXPECT_EQ(q.push_n(in.begin(), 1), static_cast<size_t>(0));
+  std::vector<int> out(10, 0);
+  EXPECT_EQ(q.pop_n(out.begin(), 3), static_cast<size_t>(3));
+  EXPECT_EQ(q.push_n(in.begin() + 8, 2), static_cast<size_t>(2));
+  EXPECT_EQ(q.pop_n(out.begin() + 3, 10), static_cast<size_t>(7));
+  EXPECT_EQ(out, in);
+  EXPECT_EQ(q.pop_n(out.begin(), 1), static_cast<size_t>(0));
+}
+
+TEST(spsc_queue_suite, move_only_elements) {
+  s21::spsc_queue<std::unique_ptr<int>, 2> q;
+  EXPECT_TRUE(q.try_push(std::make_unique<int>(7)));
+  std::unique_ptr<int> p;
+  ASSERT_TRUE(q.try_pop(p));
+  EXPECT_EQ(*p, 7);
+}
+
+TEST(spsc_queue_suite, destroys_what_is_left) {
+  {
+    s21::spsc_queue<tracked, 4> q;
+    q.try_emplace(1);
+    q.try_emplace(2);
+    q.try_emplace(3);
+    tracked out;
+    q.try_pop(out);
+    EXPECT_EQ(tracked::live, 3);
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+TEST(spsc_queue_suite, failed_batch_publishes_nothing) {
+  s21::spsc_queue<fragile, 4> q;
+  std::vector<fragile> in(3);
+  fragile::copies_left = 0;
+  EXPECT_THROW(q.push_n(in.begin(), in.size()), std::runtime_error);
+  fragile::copies_left = -1;
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.push_n(in.begin(), in.size()), static_cast<size_t>(3));
+}
+
+TEST(spsc_queue_suite, two_threads_keep_order) {
+  const std::uint64_t n = 200000;
+  auto q = std::make_unique<s21::spsc_queue<std::uint64_t, 256>>();
+  std::thread producer([&q, n] {
+    std::uint64_t batch[16];
+    for (std::uint64_t i = 0; i < n;) {
+      if (i % 3 == 0) {
+        if (q->try_push(i)) ++i;
+      } else {
+        std::uint64_t k = 0;
+        for (; k < 16 && i + k < n; ++k) batch[k] = i + k;
+        i += q->push_n(batch, k);
+      }
+      std::this_thread::yield();
+    }
+  });
+  std::uint64_t expected = 0;
+  bool ordered = true;
+  std::uint64_t batch[32];
+  while (expected < n) {
+    std::size_t got = q->pop_n(batch, 32);
+    for (std::size_t k = 0; k < got; ++k) ordered &= batch[k] == expected++;
+    if (got == 0) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q->empty());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+#include <cstddef>
+
+#include "../bench/s21_bench.h"
+#include "../list/s21_list.h"
+#include "s21_stack.h"
+
+namespace {
+
+const int kReps = 5;
+
+// Pushes n values, then pops them all again, summing each top().
+template <class Stack>
+void push_pop(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    Stack s;
+    for (std::size_t i = 0; i < n; ++i) s.push(static_cast<int>(i));
+    long long sum = 0;
+    while (!s.empty()) {
+      sum += s.top();
+      s.pop();
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, n, 2 * n, ns);
+}
+
+// Keeps the stack shallow and alternates push and pop, as a DFS or an
+// expression evaluator does; the vector keeps its buffer between rounds.
+template <class Stack>
+void churn(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    Stack s;
+    long long sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      s.push(static_cast<int>(i));
+      s.push(static_cast<int>(i + 1));
+      sum += s.top();
+      s.pop();
+      s.pop();
+    }
+    s21::bench::do_not_optimize(sum);
+  });
+  s21::bench::report(name, n, 4 * n, ns);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 20}) {
+    push_pop<s21::stack<int, s21::list<int>>>("s21::stack<int, list> push/pop",
+                                              n);
+    push_pop<s21::stack<int>>("s21::stack<int, vector> push/pop", n);
+  }
+  std::size_t n = std::size_t(1) << 20;
+  churn<s21::stack<int, s21::list<int>>>("s21::stack<int, list> churn", n);
+  churn<s21::stack<int>>("s21::stack<int, vector> churn", n);
+  return 0;
+}
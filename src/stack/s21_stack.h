@@ -1,17 +1,28 @@
 #ifndef CONTAINERS_STACK_H
 #define CONTAINERS_STACK_H
 
-#include "../list/s21_list.h"
-#include "iostream"
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+#include "../vector/s21_vector.h"
 
 namespace s21 {
-template <class T>
-class stack : protected list<T> {
+// LIFO adaptor over Container, which needs back(), push_back() and
+// pop_back(). The default keeps the elements in one contiguous s21::vector,
+// so push and pop are amortized O(1) without a heap allocation per element;
+// s21::list still works as the Container. As with the list-backed stack,
+// top() of an empty stack is a default T and pop() does nothing. top()
+// returns Container::const_reference, which is a plain bool for the packed
+// s21::vector<bool>.
+template <class T, class Container = s21::vector<T>>
+class stack {
  public:
   // Member type
+  using container_type = Container;
   using value_type = T;
-  using reference = T &;
-  using const_reference = const T &;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
   using size_type = std::size_t;
 
   // Functions
@@ -27,8 +38,8 @@ class stack : protected list<T> {
   const_reference top();
 
   // Capacity
-  using list<T>::empty;
-  using list<T>::size;
+  bool empty() const;
+  size_type size() const;
 
   //   Modifiers
   void push(const_reference value);
@@ -38,61 +49,96 @@ class stack : protected list<T> {
   // Modifiers DOP
   template <class... Args>
   void insert_many_front(Args &&...args);
+
+ private:
+  template <class Tuple, std::size_t... I>
+  void insert_reversed(Tuple &&args, std::index_sequence<I...>);
+
+  Container c_;
 };
 
 ////////////////////////////////// Constructor ///////////////////////////////
-template <class T>
-stack<T>::stack() : list<T>() {}
+template <class T, class Container>
+stack<T, Container>::stack() : c_() {}
 
-template <class T>
-stack<T>::stack(std::initializer_list<value_type> const &items)
-    : list<T>(items) {}
+template <class T, class Container>
+stack<T, Container>::stack(std::initializer_list<value_type> const &items)
+    : c_(items) {}
 
-template <class T>
-stack<T>::stack(const stack &q) : list<T>(q) {}
+template <class T, class Container>
+stack<T, Container>::stack(const stack &q) : c_(q.c_) {}
 
-template <class T>
-stack<T>::stack(stack &&q) noexcept : list<T>(std::move(q)) {}
+template <class T, class Container>
+stack<T, Container>::stack(stack &&q) noexcept : c_(std::move(q.c_)) {}
 
-template <class T>
-stack<T>::~stack() {}
+template <class T, class Container>
+stack<T, Container>::~stack() {}
 
 //////////////////////////// Operator Constructor /////////////////?//////////
-template <class T>
-stack<T> &stack<T>::operator=(stack &&q) noexcept {
+template <class T, class Container>
+stack<T, Container> &stack<T, Container>::operator=(stack &&q) noexcept {
   if (this != &q) {
-    list<T>::operator=(std::move(q));
+    c_ = std::move(q.c_);
   }
   return *this;
 }
 
 ////////////////////////////////// Access //////////////////////////////////
-template <class T>
-typename stack<T>::const_reference stack<T>::top() {
-  return list<T>::back();
+template <class T, class Container>
+typename stack<T, Container>::const_reference stack<T, Container>::top() {
+  static const value_type default_value = value_type{};
+  if (c_.empty()) {
+    return default_value;
+  }
+  return c_.back();
+}
+
+////////////////////////////////// Capacity //////////////////////////////////
+template <class T, class Container>
+bool stack<T, Container>::empty() const {
+  return c_.empty();
+}
+
+template <class T, class Container>
+typename stack<T, Container>::size_type stack<T, Container>::size() const {
+  return c_.size();
 }
 
 ////////////////////////////////// Modifiers //////////////////////////////////
-template <class T>
-void stack<T>::push(const_reference value) {
-  list<T>::push_back(value);
+template <class T, class Container>
+void stack<T, Container>::push(const_reference value) {
+  c_.push_back(value);
 }
 
-template <class T>
-void stack<T>::pop() {
-  list<T>::pop_back();
+template <class T, class Container>
+void stack<T, Container>::pop() {
+  if (!c_.empty()) {
+    c_.pop_back();
+  }
 }
 
-template <class T>
-void stack<T>::swap(stack &other) {
-  list<T>::swap(other);
+template <class T, class Container>
+void stack<T, Container>::swap(stack &other) {
+  c_.swap(other.c_);
 }
 
 /////////////////////////////// Modifiers DOP ///////////////////////////////
-template <class T>
+// Puts args under the existing elements, the last one at the very bottom,
+// with a single insert_many() at the front of the Container.
+template <class T, class Container>
 template <typename... Args>
-void stack<T>::insert_many_front(Args &&...args) {
-  list<T>::insert_many_front(args...);
+void stack<T, Container>::insert_many_front(Args &&...args) {
+  insert_reversed(std::forward_as_tuple(std::forward<Args>(args)...),
+                  std::index_sequence_for<Args...>());
+}
+
+// Passes the elements of args to insert_many() last to first.
+template <class T, class Container>
+template <class Tuple, std::size_t... I>
+void stack<T, Container>::insert_reversed(Tuple &&args,
+                                          std::index_sequence<I...>) {
+  c_.insert_many(c_.begin(),
+                 std::get<sizeof...(I) - 1 - I>(std::forward<Tuple>(args))...);
 }
 
 }  // namespace s21
@@ -1,5 +1,7 @@
 #include <stack>
 
+#include "../allocator/s21_allocator.h"
+#include "../list/s21_list.h"
 #include "gtest/gtest.h"
 #include "s21_stack.h"
 
@@ -345,6 +347,14 @@ TEST(size_suite, true_test) {
   EXPECT_TRUE(s21_b.size() == std_b.size());
 }
 
+TEST(size_suite, const_test) {
+  const s21::stack<int> s21_a({1, 2, 3});
+  const std::stack<int> std_a({1, 2, 3});
+
+  EXPECT_EQ(s21_a.size(), std_a.size());
+  EXPECT_EQ(s21_a.empty(), std_a.empty());
+}
+
 TEST(size_suite, push_test) {
   s21::stack<int> s21_a;
   std::stack<int> std_a;
@@ -433,6 +443,83 @@ TEST(stack_insert_many_front, insert) {
   EXPECT_TRUE(s21_a.top() == 6);
 }
 
+TEST(stack_container_suite, list_backed) {
+  s21::stack<int, s21::list<int>> s21_a({1, 2});
+  std::stack<int> std_a({1, 2});
+  for (int i = 3; i <= 100; ++i) {
+    s21_a.push(i);
+    std_a.push(i);
+  }
+  while (!std_a.empty()) {
+    EXPECT_EQ(s21_a.top(), std_a.top());
+    s21_a.pop();
+    std_a.pop();
+  }
+  EXPECT_TRUE(s21_a.empty());
+}
+
+TEST(stack_container_suite, list_backed_insert_many_front) {
+  s21::stack<int, s21::list<int>> s21_a({1, 2, 3});
+  s21_a.insert_many_front(4, 5, 6);
+  EXPECT_EQ(s21_a.size(), static_cast<size_t>(6));
+  for (int expected : {3, 2, 1, 4, 5, 6}) {
+    EXPECT_EQ(s21_a.top(), expected);
+    s21_a.pop();
+  }
+  EXPECT_TRUE(s21_a.empty());
+}
+
+TEST(stack_container_suite, pop_and_top_on_empty) {
+  s21::stack<int> s21_a;
+  s21_a.pop();
+  EXPECT_TRUE(s21_a.empty());
+  EXPECT_EQ(s21_a.top(), 0);
+  s21_a.push(7);
+  s21_a.pop();
+  s21_a.pop();
+  EXPECT_EQ(s21_a.size(), static_cast<size_t>(0));
+  s21_a.push(8);
+  EXPECT_EQ(s21_a.top(), 8);
+
+  s21::stack<int, s21::list<int>> s21_b;
+  s21_b.pop();
+  EXPECT_TRUE(s21_b.empty());
+  s21_b.push(9);
+  EXPECT_EQ(s21_b.top(), 9);
+}
+
+TEST(stack_container_suite, bool_stack) {
+  s21::stack<bool> s21_a;
+  std::stack<bool> std_a;
+  EXPECT_FALSE(s21_a.top());
+  for (int i = 0; i < 200; ++i) {
+    s21_a.push(i % 3 == 0);
+    std_a.push(i % 3 == 0);
+  }
+  while (!std_a.empty()) {
+    EXPECT_EQ(s21_a.top(), std_a.top());
+    s21_a.pop();
+    std_a.pop();
+  }
+  EXPECT_TRUE(s21_a.empty());
+}
+
+TEST(stack_container_suite, pool_list_backed) {
+  s21::stack<int, s21::list<int, s21::pool_allocator<int>>> s21_a;
+  std::stack<int> std_a;
+  for (int i = 0; i < 1000; ++i) {
+    s21_a.push(i);
+    std_a.push(i);
+    if (i % 3 != 0) {
+      EXPECT_EQ(s21_a.top(), std_a.top());
+      s21_a.pop();
+      std_a.pop();
+    }
+  }
+  EXPECT_EQ(s21_a.size(), std_a.size());
+  EXPECT_EQ(s21_a.top(), std_a.top());
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,39 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_TEST_H
+#define CPP2_S21_CONTAINERS_1_S21_TEST_H
+
+#include <stdexcept>
+
+namespace s21 {
+namespace test {
+
+// Counts live objects so tests can check nothing leaks or is destroyed twice.
+struct tracked {
+  static inline int live = 0;
+  explicit tracked(int v = 0) noexcept : value(v) { ++live; }
+  tracked(const tracked &other) noexcept : value(other.value) { ++live; }
+  tracked &operator=(const tracked &) noexcept = default;
+  ~tracked() { --live; }
+  int value;
+};
+
+// Counts live objects like tracked, but its copies throw once copies_left
+// reaches zero; -1 never throws. It has no move constructor, so moves and
+// relocations copy too and can fail half way.
+struct fragile {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+  explicit fragile(int v = 0) : value(v) { ++live; }
+  fragile(const fragile &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  fragile &operator=(const fragile &) = default;
+  ~fragile() { --live; }
+  int value;
+};
+
+}  // namespace test
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_TEST_H
@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../bench/s21_bench.h"
+#include "../map/s21_map.h"
+#include "s21_timer_wheel.h"
+
+namespace {
+
+const int kReps = 3;
+
+using key = std::pair<std::uint64_t, std::uint64_t>;
+
+// The approach the wheel replaces: timeouts ordered by (deadline, id) in an
+// s21::map, cancelled by lookup and erase, expired from begin().
+class map_timers {
+ public:
+  std::uint64_t schedule(std::uint64_t delay, std::uint64_t id) {
+    timers_.insert(key(now_ + delay, id), id);
+    return now_ + delay;
+  }
+  void cancel(std::uint64_t deadline, std::uint64_t id) {
+    timers_.erase(timers_.find(key(deadline, id)));
+  }
+  std::size_t advance(std::uint64_t ticks) {
+    now_ += ticks;
+    std::size_t fired = 0;
+    while (!timers_.empty()) {
+      auto it = timers_.begin();
+      if ((*it).first.first > now_) break;
+      s21::bench::do_not_optimize((*it).second);
+      timers_.erase(it);
+      ++fired;
+    }
+    return fired;
+  }
+
+ private:
+  s21::map<key, std::uint64_t> timers_;
+  std::uint64_t now_ = 0;
+};
+
+std::vector<std::uint64_t> random_delays(std::size_t n) {
+  std::mt19937_64 rng(9);
+  std::vector<std::uint64_t> delays(n);
+  for (std::uint64_t &d : delays) d = 1 + rng() % 100000;
+  return delays;
+}
+
+// Schedule n timeouts, cancel every other one (most timeouts never fire),
+// then run the clock until the rest have fired.
+void schedule_cancel_expire(const std::vector<std::uint64_t> &delays) {
+  std::size_t n = delays.size();
+  double ns = s21::bench::measure(kReps, [&] {
+    map_timers m;
+    std::vector<std::uint64_t> deadlines(n);
+    for (std::size_t i = 0; i < n; ++i) deadlines[i] = m.schedule(delays[i], i);
+    for (std::size_t i = 0; i < n; i += 2) m.cancel(deadlines[i], i);
+    std::size_t fired = 0;
+    for (int tick = 0; tick < 100000; tick += 100) fired += m.advance(100);
+    s21::bench::do_not_optimize(fired);
+  });
+  s21::bench::report("s21::map schedule+cancel+expire", n, n * 2, ns);
+
+  ns = s21::bench::measure(kReps, [&] {
+    s21::timer_wheel<std::uint64_t> w;
+    std::vector<std::uint64_t> ids(n);
+    for (std::size_t i = 0; i < n; ++i) ids[i] = w.schedule(delays[i], i);
+    for (std::size_t i = 0; i < n; i += 2) w.cancel(ids[i]);
+    std::size_t fired = 0;
+    for (int tick = 0; tick < 100000; tick += 100) {
+      fired += w.advance(
+          100, [](std::uint64_t &id) { s21::bench::do_not_optimize(id); });
+    }
+    s21::bench::do_not_optimize(fired);
+  });
+  s21::bench::report("s21::timer_wheel schedule+cancel+expire", n, n * 2, ns);
+}
+
+// Steady state with n live timeouts: each tick re-arms a batch (cancel the
+// old timeout, schedule a new one), as a connection table does on traffic.
+// The time includes arming the first n.
+void rearm(std::size_t n) {
+  const std::size_t kTicks = 100;
+  const std::size_t kPerTick = n / 100;
+  std::vector<std::uint64_t> delays = random_delays(n);
+  std::size_t ops = kTicks * kPerTick;
+
+  double ns = s21::bench::measure(kReps, [&] {
+    map_timers m;
+    std::vector<std::uint64_t> deadlines(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      deadlines[i] = m.schedule(delays[i] + kTicks, i);
+    }
+    std::size_t next = 0;
+    for (std::size_t tick = 0; tick < kTicks; ++tick) {
+      for (std::size_t j = 0; j < kPerTick; ++j, next = (next + 1) % n) {
+        m.cancel(deadlines[next], next);
+        deadlines[next] = m.schedule(delays[next] + kTicks, next);
+      }
+      m.advance(1);
+    }
+  });
+  s21::bench::report("s21::map re-arm", n, ops, ns);
+
+  ns = s21::bench::measure(kReps, [&] {
+    s21::timer_wheel<std::uint64_t> w;
+    std::vector<std::uint64_t> ids(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      ids[i] = w.schedule(delays[i] + kTicks, i);
+    }
+    std::size_t next = 0;
+    for (std::size_t tick = 0; tick < kTicks; ++tick) {
+      for (std::size_t j = 0; j < kPerTick; ++j, next = (next + 1) % n) {
+        w.cancel(ids[next]);
+        ids[next] = w.schedule(delays[next] + kTicks, next);
+      }
+      w.advance(1, [](std::uint64_t &id) { s21::bench::do_not_optimize(id); });
+    }
+  });
+  s21::bench::report("s21::timer_wheel re-arm", n, ops, ns);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 14, std::size_t(1) << 20}) {
+    schedule_cancel_expire(random_delays(n));
+    rearm(n);
+  }
+  return 0;
+}
@@ -0,0 +1,319 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_TIMER_WHEEL_H
+#define CPP2_S21_CONTAINERS_1_S21_TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Timers carrying a T, keyed by an integer tick, in a hierarchical timing
+// wheel. Level L has 64 slots of 64^L ticks each; a timer sits at the level
+// of the highest 6-bit digit in which its expiry differs from now(), in the
+// slot named by that digit. Scheduling and cancelling are O(1): they link or
+// unlink one node and flip one occupancy bit. When the clock reaches a slot
+// of level L its timers are redistributed to lower levels, so each timer is
+// moved at most kLevels times over its life and advancing is amortized O(1)
+// per timer. Empty stretches of time are skipped with the occupancy
+// bitmaps, so advance_to() does not walk every tick.
+//
+// Nodes come from a pool that grows as a s21::vector and are linked by
+// 32-bit index, so growth never invalidates a link and cancelled or fired
+// nodes are reused without touching the allocator. A timer_id names the node
+// and its generation, so cancelling one that already fired is a harmless
+// no-op even after its node is reused.
+template <class T>
+class timer_wheel {
+ public:
+  //  Member type
+  using value_type = T;
+  using size_type = size_t;
+  using time_type = std::uint64_t;
+  using timer_id = std::uint64_t;
+
+  static constexpr size_type kSlotBits = 6;
+  static constexpr size_type kSlots = size_type(1) << kSlotBits;
+  static constexpr size_type kLevels = (64 + kSlotBits - 1) / kSlotBits;
+
+  //  Member functions
+  explicit timer_wheel(time_type now = 0);
+
+  //  Clock
+  time_type now() const { return now_; }
+
+  //  Capacity
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  void reserve(size_type count);
+
+  //  Modifiers
+  // Schedule value to fire when the clock reaches expiry. A timer due at or
+  // before now() fires on the next advance, never from inside schedule.
+  timer_id schedule_at(time_type expiry, const T &value);
+  timer_id schedule_at(time_type expiry, T &&value);
+  timer_id schedule(time_type delay, const T &value);
+  timer_id schedule(time_type delay, T &&value);
+  // Returns false if id already fired or was cancelled.
+  bool cancel(timer_id id);
+  bool pending(timer_id id) const;
+  // Move the clock to time, calling fn(T &) for every timer that comes due
+  // on the way, in expiry order (timers due on the same tick in no
+  // particular order). fn may schedule and cancel timers. Returns how many
+  // fired.
+  template <class Fn>
+  size_type advance_to(time_type time, Fn &&fn);
+  template <class Fn>
+  size_type advance(time_type ticks, Fn &&fn);
+  void clear();
+
+ private:
+  using index_type = std::uint32_t;
+
+  static constexpr index_type kNil = std::numeric_limits<index_type>::max();
+  static constexpr std::uint16_t kFree = 0xFFFF;
+
+  struct node {
+    T value;
+    time_type expiry;
+    index_type prev;
+    index_type next;
+    std::uint32_t generation;
+    // level * kSlots + slot, or kFree while the node is on the free list.
+    std::uint16_t slot;
+  };
+
+  s21::vector<node> nodes_;
+  index_type heads_[kLevels * kSlots];
+  std::uint64_t occupied_[kLevels] = {};
+  index_type free_ = kNil;
+  size_type size_ = 0;
+  time_type now_;
+
+  timer_id insert(time_type expiry, T &&value);
+  void link(index_type index);
+  void unlink(index_type index);
+  T release(index_type index);
+  time_type next_event() const;
+  void cascade(size_type level);
+  template <class Fn>
+  size_type expire(Fn &fn);
+};
+
+// CONSTRUCTOR
+
+template <class T>
+timer_wheel<T>::timer_wheel(time_type now) : now_(now) {
+  for (index_type &head : heads_) head = kNil;
+}
+
+// Capacity
+
+template <class T>
+void timer_wheel<T>::reserve(size_type count) {
+  nodes_.reserve(count);
+}
+
+// Modifiers
+
+template <class T>
+typename timer_wheel<T>::timer_id timer_wheel<T>::schedule_at(
+    time_type expiry, const T &value) {
+  return insert(expiry, T(value));
+}
+
+template <class T>
+typename timer_wheel<T>::timer_id timer_wheel<T>::schedule_at(time_type expiry,
+                                                              T &&value) {
+  return insert(expiry, std::move(value));
+}
+
+template <class T>
+typename timer_wheel<T>::timer_id timer_wheel<T>::schedule(time_type delay,
+                                                           const T &value) {
+  return insert(now_ + delay, T(value));
+}
+
+template <class T>
+typename timer_wheel<T>::timer_id timer_wheel<T>::schedule(time_type delay,
+                                                           T &&value) {
+  return insert(now_ + delay, std::move(value));
+}
+
+template <class T>
+bool timer_wheel<T>::cancel(timer_id id) {
+  if (!pending(id)) return false;
+  index_type index = static_cast<index_type>(id);
+  unlink(index);
+  release(index);
+  --size_;
+  return true;
+}
+
+template <class T>
+bool timer_wheel<T>::pending(timer_id id) const {
+  index_type index = static_cast<index_type>(id);
+  if (index >= nodes_.size()) return false;
+  const node &n = nodes_[index];
+  return n.slot != kFree && n.generation == id >> 32;
+}
+
+template <class T>
+template <class Fn>
+typename timer_wheel<T>::size_type timer_wheel<T>::advance_to(time_type time,
+                                                              Fn &&fn) {
+  size_type fired = 0;
+  while (size_ != 0) {
+    time_type next = next_event();
+    if (next > time) break;
+    now_ = next;
+    for (size_type level = kLevels - 1; level > 0; --level) cascade(level);
+    fired += expire(fn);
+  }
+  if (time > now_) now_ = time;
+  return fired;
+}
+
+template <class T>
+template <class Fn>
+typename timer_wheel<T>::size_type timer_wheel<T>::advance(time_type ticks,
+                                                           Fn &&fn) {
+  return advance_to(now_ + ticks, fn);
+}
+
+template <class T>
+void timer_wheel<T>::clear() {
+  for (index_type i = 0; i < nodes_.size(); ++i) {
+    if (nodes_[i].slot != kFree) release(i);
+  }
+  for (index_type &head : heads_) head = kNil;
+  for (std::uint64_t &bits : occupied_) bits = 0;
+  size_ = 0;
+}
+
+// Nodes
+
+template <class T>
+typename timer_wheel<T>::timer_id timer_wheel<T>::insert(time_type expiry,
+                                                         T &&value) {
+  if (expiry <= now_) expiry = now_ + 1;
+  index_type index = free_;
+  if (index != kNil) {
+    free_ = nodes_[index].next;
+    nodes_[index].value = std::move(value);
+  } else {
+    if (nodes_.size() >= kNil) {
+      throw std::length_error("timer_wheel is full");
+    }
+    index = static_cast<index_type>(nodes_.size());
+    nodes_.push_back(node{std::move(value), 0, kNil, kNil, 0, kFree});
+  }
+  nodes_[index].expiry = expiry;
+  link(index);
+  ++size_;
+  return timer_id(nodes_[index].generation) << 32 | index;
+}
+
+// Files the node under the highest digit in which its expiry differs from
+// now_. An expiry equal to now_ (only reached while cascading) goes to the
+// current level-0 slot, which expire() drains next.
+template <class T>
+void timer_wheel<T>::link(index_type index) {
+  node &n = nodes_[index];
+  size_type level = 0;
+  if (n.expiry != now_) {
+    level = (63 - __builtin_clzll(n.expiry ^ now_)) / kSlotBits;
+  }
+  size_type slot = (n.expiry >> (level * kSlotBits)) & (kSlots - 1);
+  size_type head = level * kSlots + slot;
+  n.slot = static_cast<std::uint16_t>(head);
+  n.prev = kNil;
+  n.next = heads_[head];
+  if (n.next != kNil) nodes_[n.next].prev = index;
+  heads_[head] = index;
+  occupied_[level] |= std::uint64_t(1) << slot;
+}
+
+template <class T>
+void timer_wheel<T>::unlink(index_type index) {
+  node &n = nodes_[index];
+  if (n.prev != kNil) {
+    nodes_[n.prev].next = n.next;
+  } else {
+    heads_[n.slot] = n.next;
+  }
+  if (n.next != kNil) nodes_[n.next].prev = n.prev;
+  if (heads_[n.slot] == kNil) {
+    occupied_[n.slot / kSlots] &= ~(std::uint64_t(1) << (n.slot % kSlots));
+  }
+}
+
+// Puts the node on the free list and moves its value out, so a cancelled
+// or cleared timer's payload is destroyed now rather than when the node is
+// next reused.
+template <class T>
+T timer_wheel<T>::release(index_type index) {
+  node &n = nodes_[index];
+  n.slot = kFree;
+  ++n.generation;
+  n.next = free_;
+  free_ = index;
+  return std::move(n.value);
+}
+
+// Wheel
+
+// The first occupied slot of the lowest non-empty level is the next time
+// anything happens: every timer on a level expires before the next slot of
+// the level above it comes round.
+template <class T>
+typename timer_wheel<T>::time_type timer_wheel<T>::next_event() const {
+  for (size_type level = 0; level < kLevels; ++level) {
+    if (occupied_[level] == 0) continue;
+    size_type shift = level * kSlotBits;
+    size_type window = shift + kSlotBits;
+    time_type base = window >= 64 ? 0 : now_ >> window << window;
+    return base + (time_type(__builtin_ctzll(occupied_[level])) << shift);
+  }
+  return std::numeric_limits<time_type>::max();
+}
+
+template <class T>
+void timer_wheel<T>::cascade(size_type level) {
+  size_type slot = (now_ >> (level * kSlotBits)) & (kSlots - 1);
+  if ((occupied_[level] >> slot & 1) == 0) return;
+  size_type head = level * kSlots + slot;
+  index_type index = heads_[head];
+  heads_[head] = kNil;
+  occupied_[level] &= ~(std::uint64_t(1) << slot);
+  while (index != kNil) {
+    index_type next = nodes_[index].next;
+    link(index);
+    index = next;
+  }
+}
+
+// Fires the current level-0 slot one node at a time, releasing each node
+// before calling fn so fn can schedule into it or cancel its neighbours.
+template <class T>
+template <class Fn>
+typename timer_wheel<T>::size_type timer_wheel<T>::expire(Fn &fn) {
+  size_type head = now_ & (kSlots - 1);
+  size_type fired = 0;
+  while (heads_[head] != kNil) {
+    index_type index = heads_[head];
+    unlink(index);
+    T value = release(index);
+    --size_;
+    ++fired;
+    fn(value);
+  }
+  return fired;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_TIMER_WHEEL_H
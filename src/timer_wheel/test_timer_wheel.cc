@@ -0,0 +1,193 @@
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "s21_timer_wheel.h"
+
+namespace {
+
+using wheel = s21::timer_wheel<int>;
+
+// Records what fired and at which tick.
+struct recorder {
+  wheel *w;
+  std::vector<std::pair<std::uint64_t, int>> *fired;
+  void operator()(int &value) const { fired->push_back({w->now(), value}); }
+};
+
+}  // namespace
+
+TEST(timer_wheel_suite, fires_on_its_tick) {
+  wheel w;
+  std::vector<std::pair<std::uint64_t, int>> fired;
+  recorder rec{&w, &fired};
+  EXPECT_TRUE(w.empty());
+  w.schedule(5, 1);
+  w.schedule_at(3, 2);
+  w.schedule(70, 3);
+  EXPECT_EQ(w.size(), static_cast<size_t>(3));
+  EXPECT_EQ(w.advance(2, rec), static_cast<size_t>(0));
+  EXPECT_EQ(w.advance(1, rec), static_cast<size_t>(1));
+  EXPECT_EQ(w.advance_to(100, rec), static_cast<size_t>(2));
+  std::vector<std::pair<std::uint64_t, int>> expected = {
+      {3, 2}, {5, 1}, {70, 3}};
+  EXPECT_EQ(fired, expected);
+  EXPECT_EQ(w.now(), static_cast<std::uint64_t>(100));
+  EXPECT_TRUE(w.empty());
+}
+
+TEST(timer_wheel_suite, cancel_and_stale_ids) {
+  wheel w(1000);
+  std::vector<std::pair<std::uint64_t, int>> fired;
+  recorder rec{&w, &fired};
+  auto a = w.schedule(10, 1);
+  auto b = w.schedule(10, 2);
+  EXPECT_TRUE(w.pending(a));
+  EXPECT_TRUE(w.cancel(a));
+  EXPECT_FALSE(w.cancel(a));
+  EXPECT_FALSE(w.pending(a));
+  auto c = w.schedule(20, 3);
+  EXPECT_NE(c, a);
+  EXPECT_FALSE(w.cancel(a));
+  const wheel &view = w;
+  EXPECT_TRUE(view.pending(c));
+  w.advance(10, rec);
+  EXPECT_FALSE(w.cancel(b));
+  EXPECT_EQ(w.size(), static_cast<size_t>(1));
+  EXPECT_EQ(fired.size(), static_cast<size_t>(1));
+  EXPECT_EQ(fired[0].second, 2);
+  EXPECT_FALSE(w.pending(12345));
+}
+
+TEST(timer_wheel_suite, long_delays_cascade_down) {
+  wheel w;
+  std::vector<std::pair<std::uint64_t, int>> fired;
+  recorder rec{&w, &fired};
+  std::uint64_t delays[] = {64,       65,       4095,     4096,
+                            262143,   262145,   1u << 30, 1ull << 40,
+                            1ull << 62, (1ull << 63) + 12345};
+  for (int i = 0; i < 10; ++i) w.schedule(delays[i], i);
+  EXPECT_EQ(w.advance_to(~0ull, rec), static_cast<size_t>(10));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(fired[i].first, delays[i]);
+    EXPECT_EQ(fired[i].second, i);
+  }
+}
+
+TEST(timer_wheel_suite, past_due_fires_on_next_advance) {
+  wheel w(500);
+  std::vector<std::pair<std::uint64_t, int>> fired;
+  recorder rec{&w, &fired};
+  w.schedule_at(10, 1);
+  w.schedule(0, 2);
+  EXPECT_EQ(w.advance(0, rec), static_cast<size_t>(0));
+  EXPECT_EQ(w.advance(1, rec), static_cast<size_t>(2));
+  EXPECT_EQ(fired[0].first, static_cast<std::uint64_t>(501));
+  EXPECT_EQ(w.advance_to(5, rec), static_cast<size_t>(0));
+  EXPECT_EQ(w.now(), static_cast<std::uint64_t>(501));
+}
+
+TEST(timer_wheel_suite, callback_schedules_and_cancels) {
+  wheel w;
+  std::vector<std::uint64_t> ticks;
+  wheel::timer_id victim = w.schedule(8, -1);
+  w.schedule(8, 0);
+  auto periodic = [&](int &value) {
+    if (value < 0) {
+      ADD_FAILURE() << "cancelled timer fired";
+      return;
+    }
+    w.cancel(victim);
+    ticks.push_back(w.now());
+    if (value < 4) w.schedule(8, value + 1);
+  };
+  w.advance_to(1000, periodic);
+  std::vector<std::uint64_t> expected = {8, 16, 24, 32, 40};
+  EXPECT_EQ(ticks, expected);
+  EXPECT_TRUE(w.empty());
+}
+
+TEST(timer_wheel_suite, clear_and_string_values) {
+  s21::timer_wheel<std::string> w;
+  auto id = w.schedule(5, std::string("five"));
+  w.schedule(6, std::string("six"));
+  w.clear();
+  EXPECT_TRUE(w.empty());
+  EXPECT_FALSE(w.pending(id));
+  std::string seen;
+  w.schedule(2, std::string("two"));
+  w.advance(10, [&seen](std::string &v) { seen = std::move(v); });
+  EXPECT_EQ(seen, "two");
+}
+
+TEST(timer_wheel_suite, cancel_and_clear_free_payloads) {
+  auto resource = std::make_shared<int>(1);
+  s21::timer_wheel<std::shared_ptr<int>> w;
+  auto id = w.schedule(5, resource);
+  w.schedule(6, resource);
+  w.schedule(7, resource);
+  EXPECT_EQ(resource.use_count(), 4);
+  EXPECT_TRUE(w.cancel(id));
+  EXPECT_EQ(resource.use_count(), 3);
+  w.clear();
+  EXPECT_EQ(resource.use_count(), 1);
+  w.schedule(1, resource);
+  w.advance(1, [](std::shared_ptr<int> &) {});
+  EXPECT_EQ(resource.use_count(), 1);
+}
+
+TEST(timer_wheel_suite, matches_ordered_map) {
+  wheel w;
+  std::multimap<std::uint64_t, int> expected;
+  std::vector<wheel::timer_id> ids;
+  std::vector<std::uint64_t> due;
+  std::mt19937_64 rng(5);
+  std::vector<std::pair<std::uint64_t, int>> fired;
+  recorder rec{&w, &fired};
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      std::uint64_t delay = 1 + rng() % (std::uint64_t(1) << (rng() % 24));
+      int value = static_cast<int>(ids.size());
+      ids.push_back(w.schedule(delay, value));
+      due.push_back(w.now() + delay);
+      expected.insert({w.now() + delay, value});
+    }
+    for (int i = 0; i < 10; ++i) {
+      std::size_t victim = rng() % ids.size();
+      auto range = expected.equal_range(due[victim]);
+      bool live = false;
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == static_cast<int>(victim)) {
+          expected.erase(it);
+          live = true;
+          break;
+        }
+      }
+      EXPECT_EQ(w.cancel(ids[victim]), live);
+    }
+    fired.clear();
+    std::uint64_t to = w.now() + rng() % 100000;
+    w.advance_to(to, rec);
+    std::vector<std::pair<std::uint64_t, int>> want;
+    while (!expected.empty() && expected.begin()->first <= to) {
+      want.push_back(*expected.begin());
+      expected.erase(expected.begin());
+    }
+    ASSERT_EQ(fired.size(), want.size());
+    for (std::size_t i = 0; i < want.size(); ++i) {
+      EXPECT_EQ(fired[i].first, want[i].first);
+      EXPECT_EQ(due[fired[i].second], fired[i].first);
+    }
+    EXPECT_EQ(w.size(), expected.size());
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -9,6 +9,106 @@
 
 namespace s21 {
 
+namespace internal {
+
+// AVL height bookkeeping and rotations for any node type with left, right
+// and parent pointers and an int height. Rotations keep parent links and
+// root (the tree's root pointer) up to date, so callers can rebalance
+// bottom-up from any node. Shared by BinaryTree and intrusive_set.
+template <class Node>
+struct avl {
+  static int height(const Node *n) { return n ? n->height : 0; }
+
+  static int balance_factor(const Node *n) {
+    return n ? height(n->left) - height(n->right) : 0;
+  }
+
+  static void update_height(Node *n) {
+    n->height = std::max(height(n->left), height(n->right)) + 1;
+  }
+
+  static Node *rotate_right(Node *y, Node *&root) {
+    Node *x = y->left;
+    Node *T2 = x->right;
+
+    x->right = y;
+    y->left = T2;
+
+    if (T2 != nullptr) {
+      T2->parent = y;
+    }
+    x->parent = y->parent;
+
+    if (y->parent == nullptr) {
+      root = x;
+    } else if (y == y->parent->left) {
+      y->parent->left = x;
+    } else {
+      y->parent->right = x;
+    }
+
+    y->parent = x;
+
+    update_height(y);
+    update_height(x);
+
+    return x;
+  }
+
+  static Node *rotate_left(Node *x, Node *&root) {
+    Node *y = x->right;
+    Node *T2 = y->left;
+
+    y->left = x;
+    x->right = T2;
+
+    if (T2 != nullptr) {
+      T2->parent = x;
+    }
+    y->parent = x->parent;
+
+    if (x->parent == nullptr) {
+      root = y;
+    } else if (x == x->parent->left) {
+      x->parent->left = y;
+    } else {
+      x->parent->right = y;
+    }
+    x->parent = y;
+
+    update_height(x);
+    update_height(y);
+
+    return y;
+  }
+
+  // Restores the AVL property at n, whose subtrees are balanced and whose
+  // height is current, and returns the root of the rebalanced subtree.
+  static Node *rebalance(Node *n, Node *&root) {
+    if (!n) return n;
+
+    int balance = balance_factor(n);
+
+    if (balance > 1) {
+      if (balance_factor(n->left) < 0) {
+        n->left = rotate_left(n->left, root);
+      }
+      return rotate_right(n, root);
+    }
+
+    if (balance < -1) {
+      if (balance_factor(n->right) > 0) {
+        n->right = rotate_right(n->right, root);
+      }
+      return rotate_left(n, root);
+    }
+
+    return n;
+  }
+};
+
+}  // namespace internal
+
 template <class Key>
 class BinaryTree {
  public:
@@ -282,92 +382,27 @@ void BinaryTree<Key>::destroy(node *n) {
 
 template <class Key>
 int BinaryTree<Key>::height(node *n) const {
-  return n ? n->height : 0;
+  return internal::avl<node>::height(n);
 }
 
 template <class Key>
 int BinaryTree<Key>::getBalance(node *n) const {
-  return n ? height(n->left) - height(n->right) : 0;
+  return internal::avl<node>::balance_factor(n);
 }
 
 template <class Key>
 typename BinaryTree<Key>::node *BinaryTree<Key>::rotationRight(node *y) {
-  node *x = y->left;
-  node *T2 = x->right;
-
-  x->right = y;
-  y->left = T2;
-
-  if (T2 != nullptr) {
-    T2->parent = y;
-  }
-  x->parent = y->parent;
-
-  if (y->parent == nullptr) {
-    root_ = x;
-  } else if (y == y->parent->left) {
-    y->parent->left = x;
-  } else {
-    y->parent->right = x;
-  }
-
-  y->parent = x;
-
-  y->height = std::max(height(y->left), height(y->right)) + 1;
-  x->height = std::max(height(x->left), height(x->right)) + 1;
-
-  return x;
+  return internal::avl<node>::rotate_right(y, root_);
 }
 
 template <class Key>
 typename BinaryTree<Key>::node *BinaryTree<Key>::rotationLeft(node *x) {
-  node *y = x->right;
-  node *T2 = y->left;
-
-  y->left = x;
-  x->right = T2;
-
-  if (T2 != nullptr) {
-    T2->parent = x;
-  }
-  y->parent = x->parent;
-
-  if (x->parent == nullptr) {
-    root_ = y;
-  } else if (x == x->parent->left) {
-    x->parent->left = y;
-  } else {
-    x->parent->right = y;
-  }
-  x->parent = y;
-
-  x->height = std::max(height(x->left), height(x->right)) + 1;
-  y->height = std::max(height(y->left), height(y->right)) + 1;
-
-  return y;
+  return internal::avl<node>::rotate_left(x, root_);
 }
 
 template <class Key>
 typename BinaryTree<Key>::node *BinaryTree<Key>::balance(node *n) {
-  if (!n) return n;
-
-  int balance = getBalance(n);
-
-  if (balance > 1) {
-    if (getBalance(n->left) < 0) {
-      n->left = rotationLeft(n->left);
-    }
-    return rotationRight(n);
-  }
-
-  if (balance < -1) {
-    if (getBalance(n->right) > 0) {
-      n->right = rotationRight(n->right);
-    }
-    return rotationLeft(n);
-  }
-
-  return n;
+  return internal::avl<node>::rebalance(n, root_);
 }
 
 template <class Key>
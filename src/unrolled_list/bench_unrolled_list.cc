@@ -0,0 +1,111 @@
+#define S21_BENCH_COUNT_ALLOCATIONS
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "../bench/s21_bench.h"
+#include "../list/s21_list.h"
+#include "s21_unrolled_list.h"
+
+namespace {
+
+const int kReps = 5;
+
+template <class List>
+std::uint64_t sum(const List &l) {
+  std::uint64_t total = 0;
+  for (auto it = l.begin(); it != l.end(); ++it) total += *it;
+  return total;
+}
+
+// Builds n elements with push_back, reports the bytes that took, then times
+// a full traversal of the list as built and again after sort() has put it
+// in the order of a random key. Sorting relinks s21::list's nodes, which
+// scatters the traversal across the heap; the unrolled list moves elements
+// and keeps its nodes where they were.
+template <class List>
+void build_and_traverse(const char *build, const char *scan,
+                        const char *sorted_scan, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    List l;
+    for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+    s21::bench::do_not_optimize(l.size());
+  });
+  s21::bench::report(build, n, ns);
+
+  std::size_t before = s21::bench::allocated_bytes;
+  List l;
+  std::mt19937 rng(1);
+  for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(rng()));
+  std::printf("      bytes per element: %.2f\n",
+              static_cast<double>(s21::bench::allocated_bytes - before) / n);
+
+  auto traverse = [&l] { s21::bench::do_not_optimize(sum(l)); };
+  ns = s21::bench::measure(kReps, traverse);
+  s21::bench::report(scan, n, ns);
+  l.sort();
+  ns = s21::bench::measure(kReps, traverse);
+  s21::bench::report(sorted_scan, n, ns);
+}
+
+// One pass that inserts a new element after every existing one: O(1) per
+// insert for s21::list, a shift of up to K elements for the unrolled list.
+template <class List>
+void insert_while_iterating(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    List l;
+    for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<int>(i));
+    for (auto it = l.begin(); it != l.end();) {
+      ++it;
+      it = l.insert(it, 0);
+      ++it;
+    }
+    s21::bench::do_not_optimize(l.size());
+  });
+  s21::bench::report(name, n, ns);
+}
+
+// Inserts n elements, each at a random position found by walking from
+// begin(): the walk, not the insert, dominates both lists.
+template <class List>
+void insert_at_random(const char *name, std::size_t n) {
+  double ns = s21::bench::measure(kReps, [n] {
+    List l;
+    std::mt19937 rng(2);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto it = l.begin();
+      for (std::size_t step = rng() % (l.size() + 1); step != 0; --step) ++it;
+      l.insert(it, static_cast<int>(i));
+    }
+    s21::bench::do_not_optimize(l.size());
+  });
+  s21::bench::report(name, n, ns);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 20}) {
+    build_and_traverse<s21::list<int>>("s21::list<int> push_back",
+                                       "s21::list<int> traverse",
+                                       "s21::list<int> traverse sorted", n);
+    build_and_traverse<s21::unrolled_list<int>>(
+        "s21::unrolled_list<int> push_back",
+        "s21::unrolled_list<int> traverse",
+        "s21::unrolled_list<int> traverse sorted", n);
+    build_and_traverse<s21::unrolled_list<int, 8>>(
+        "s21::unrolled_list<int, 8> push_back",
+        "s21::unrolled_list<int, 8> traverse",
+        "s21::unrolled_list<int, 8> traverse sorted", n);
+    insert_while_iterating<s21::list<int>>("s21::list<int> insert after each",
+                                           n);
+    insert_while_iterating<s21::unrolled_list<int>>(
+        "s21::unrolled_list<int> insert after each", n);
+  }
+  std::size_t n = std::size_t(1) << 13;
+  insert_at_random<s21::list<int>>("s21::list<int> walk+insert", n);
+  insert_at_random<s21::unrolled_list<int>>(
+      "s21::unrolled_list<int> walk+insert", n);
+  return 0;
+}
@@ -0,0 +1,805 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNROLLED_LIST_H
+#define CPP2_S21_CONTAINERS_1_S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+namespace internal {
+
+// Number of T that fill a 256-byte node after its two links and its count,
+// at least four.
+template <class T>
+constexpr std::size_t default_unroll() {
+  std::size_t header = 2 * sizeof(void *) + sizeof(std::size_t);
+  std::size_t n = sizeof(T) < 256 - header ? (256 - header) / sizeof(T) : 0;
+  return n < 4 ? 4 : n;
+}
+
+}  // namespace internal
+
+// A doubly linked list whose nodes each hold up to K elements in a
+// contiguous array, with the interface of s21::list. A traversal touches one
+// node per K elements instead of one per element, and the links and the
+// allocator's header are paid once per node. Inserting into a full node
+// splits it in half; a node that erase leaves under half full merges with a
+// neighbour when both fit in one. Either way an insert or erase moves at
+// most K elements.
+//
+// Elements move between slots, so unlike s21::list an insert, erase, splice
+// or merge invalidates iterators into every node it shifts, splits or
+// joins, and sort() and unique() invalidate all of them. splice() and
+// merge() move nodes between lists, which needs both lists' allocators to
+// compare equal.
+template <class T, std::size_t K = internal::default_unroll<T>(),
+          class Allocator = std::allocator<T>>
+class unrolled_list {
+  static_assert(K >= 2, "unrolled_list nodes must hold at least two elements");
+
+  template <bool Const>
+  class basic_iterator;
+
+ public:
+  //  Member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+  using size_type = size_t;
+
+  static constexpr size_type kNodeCapacity = K;
+
+  //  Member functions
+  unrolled_list();
+  explicit unrolled_list(const Allocator &alloc);
+  explicit unrolled_list(size_type n, const Allocator &alloc = Allocator());
+  unrolled_list(std::initializer_list<value_type> const &items,
+                const Allocator &alloc = Allocator());
+  unrolled_list(const unrolled_list &l);
+  unrolled_list(unrolled_list &&l) noexcept;
+  ~unrolled_list();
+
+  unrolled_list &operator=(const unrolled_list &l);
+  unrolled_list &operator=(unrolled_list &&l) noexcept;
+
+  allocator_type get_allocator() const;
+
+  //  Element access
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  //  Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // Walks the nodes; size() / node_count() is the average fill.
+  size_type node_count() const;
+
+  //  Modifiers
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  void pop_front();
+  void swap(unrolled_list &other) noexcept;
+  void merge(unrolled_list &other);
+  template <class Compare>
+  void merge(unrolled_list &other, Compare comp);
+  // Splitting the nodes at pos and at the ends of the range and relinking
+  // the whole nodes in between costs O(K), plus one step per node moved
+  // when other is a different list and the range is not all of it.
+  void splice(const_iterator pos, unrolled_list &other);
+  void splice(const_iterator pos, unrolled_list &other, const_iterator it);
+  void splice(const_iterator pos, unrolled_list &other, const_iterator first,
+              const_iterator last);
+  void reverse();
+  void unique();
+  // Stable. The elements are moved into one contiguous buffer, sorted there
+  // and moved back, so sorting costs n extra T but no pointer chasing.
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+
+  //  Modifiers DOP
+  // Returns the element that followed pos.
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+  // Like s21::list, pushes each argument to the front in turn, so they end
+  // up in reverse order.
+  template <class... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  struct link {
+    link *next;
+    link *prev;
+  };
+
+  // Elements live in [data(), data() + count); the rest of storage is raw.
+  // Only the sentinel is ever empty.
+  struct node : link {
+    size_type count;
+    alignas(T) unsigned char storage[K * sizeof(T)];
+
+    T *data() { return reinterpret_cast<T *>(storage); }
+  };
+
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  link sentinel_{&sentinel_, &sentinel_};
+  size_type size_ = 0;
+  node_allocator alloc_{};
+
+  static node *as_node(link *l) { return static_cast<node *>(l); }
+  static void link_chain(link *pos, link *first, link *last);
+  static void unlink_chain(link *first, link *last);
+  static void take_chain(link &from, link &to);
+
+  node *create_node(link *pos);
+  void destroy_node(node *n);
+  iterator split(const_iterator it, const_iterator *track);
+  void coalesce(link *l);
+};
+
+// Bidirectional iterator naming a node and a slot in it. end() is the
+// sentinel at slot 0.
+template <class T, std::size_t K, class Allocator>
+template <bool Const>
+class unrolled_list<T, K, Allocator>::basic_iterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  basic_iterator() = default;
+  template <bool C = Const, class = std::enable_if_t<C>>
+  basic_iterator(const basic_iterator<false> &it)
+      : node_(it.node_), index_(it.index_) {}
+
+  reference operator*() const { return as_node(node_)->data()[index_]; }
+  pointer operator->() const { return &**this; }
+
+  basic_iterator &operator++() {
+    if (++index_ == as_node(node_)->count) {
+      node_ = node_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+  basic_iterator operator++(int) {
+    basic_iterator old = *this;
+    ++*this;
+    return old;
+  }
+  basic_iterator &operator--() {
+    if (index_ == 0) {
+      node_ = node_->prev;
+      index_ = as_node(node_)->count;
+    }
+    --index_;
+    return *this;
+  }
+  basic_iterator operator--(int) {
+    basic_iterator old = *this;
+    --*this;
+    return old;
+  }
+
+  friend bool operator==(const basic_iterator &a, const basic_iterator &b) {
+    return a.node_ == b.node_ && a.index_ == b.index_;
+  }
+  friend bool operator!=(const basic_iterator &a, const basic_iterator &b) {
+    return !(a == b);
+  }
+
+ private:
+  friend class unrolled_list;
+  friend class basic_iterator<true>;
+
+  basic_iterator(link *node, size_type index) : node_(node), index_(index) {}
+
+  link *node_{};
+  size_type index_{};
+};
+
+// CONSTRUCTOR
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list() = default;
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list(const Allocator &alloc)
+    : alloc_(alloc) {}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list(size_type n,
+                                              const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (size_type i = 0; i < n; ++i) push_back(T());
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list(const unrolled_list &l)
+    : alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
+  for (const_reference item : l) push_back(item);
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::unrolled_list(unrolled_list &&l) noexcept
+    : size_(std::exchange(l.size_, 0)), alloc_(l.alloc_) {
+  take_chain(l.sentinel_, sentinel_);
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator>::~unrolled_list() {
+  clear();
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator> &unrolled_list<T, K, Allocator>::operator=(
+    const unrolled_list &l) {
+  if (this != &l) {
+    unrolled_list copy(l);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class T, std::size_t K, class Allocator>
+unrolled_list<T, K, Allocator> &unrolled_list<T, K, Allocator>::operator=(
+    unrolled_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::allocator_type
+unrolled_list<T, K, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+// Element access
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::reference
+unrolled_list<T, K, Allocator>::front() {
+  return *begin();
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::const_reference
+unrolled_list<T, K, Allocator>::front() const {
+  return *begin();
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::reference
+unrolled_list<T, K, Allocator>::back() {
+  node *n = as_node(sentinel_.prev);
+  return n->data()[n->count - 1];
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::const_reference
+unrolled_list<T, K, Allocator>::back() const {
+  node *n = as_node(sentinel_.prev);
+  return n->data()[n->count - 1];
+}
+
+// Iterators
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::begin() {
+  return iterator(sentinel_.next, 0);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::end() {
+  return iterator(&sentinel_, 0);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::const_iterator
+unrolled_list<T, K, Allocator>::begin() const {
+  return const_iterator(sentinel_.next, 0);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::const_iterator
+unrolled_list<T, K, Allocator>::end() const {
+  return const_iterator(const_cast<link *>(&sentinel_), 0);
+}
+
+// Capacity
+
+template <class T, std::size_t K, class Allocator>
+bool unrolled_list<T, K, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::size_type
+unrolled_list<T, K, Allocator>::size() const {
+  return size_;
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::size_type
+unrolled_list<T, K, Allocator>::max_size() const {
+  return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::size_type
+unrolled_list<T, K, Allocator>::node_count() const {
+  size_type count = 0;
+  for (const link *l = sentinel_.next; l != &sentinel_; l = l->next) ++count;
+  return count;
+}
+
+// Modifiers
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::clear() {
+  link *l = sentinel_.next;
+  while (l != &sentinel_) {
+    link *next = l->next;
+    destroy_node(as_node(l));
+    l = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  size_ = 0;
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::insert(const_iterator pos,
+                                       const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::insert(const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// The value is built before anything moves, so a throwing constructor
+// leaves the list as it was and args may refer to an element of the list.
+template <class T, std::size_t K, class Allocator>
+template <class... Args>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::emplace(const_iterator pos, Args &&...args) {
+  T value(std::forward<Args>(args)...);
+  link *target = pos.node_;
+  size_type index = pos.index_;
+  if (target == &sentinel_ || (index == 0 && as_node(target)->count == K)) {
+    // At a node boundary: append to the node before if it has room rather
+    // than splitting, so runs of push_back and push_front fill whole nodes.
+    link *before = target->prev;
+    if (before != &sentinel_ && as_node(before)->count < K) {
+      target = before;
+      index = as_node(before)->count;
+    } else {
+      target = create_node(target);
+      index = 0;
+    }
+  } else if (as_node(target)->count == K) {
+    split(const_iterator(target, K / 2), nullptr);
+    if (index > K / 2) {
+      target = target->next;
+      index -= K / 2;
+    }
+  }
+  node *n = as_node(target);
+  T *data = n->data();
+  if (index == n->count) {
+    ::new (static_cast<void *>(data + index)) T(std::move(value));
+  } else {
+    T *last = data + n->count - 1;
+    ::new (static_cast<void *>(last + 1)) T(std::move(*last));
+    std::move_backward(data + index, last, last + 1);
+    data[index] = std::move(value);
+  }
+  ++n->count;
+  ++size_;
+  return iterator(target, index);
+}
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::erase(const_iterator pos) {
+  node *n = as_node(pos.node_);
+  size_type index = pos.index_;
+  T *data = n->data();
+  std::move(data + index + 1, data + n->count, data + index);
+  --n->count;
+  std::destroy_at(data + n->count);
+  --size_;
+  if (n->count == 0) {
+    link *next = n->next;
+    unlink_chain(n, n);
+    destroy_node(n);
+    return iterator(next, 0);
+  }
+  if (n->count < K / 2) {
+    link *prev = n->prev;
+    if (prev != &sentinel_ && as_node(prev)->count + n->count <= K) {
+      index += as_node(prev)->count;
+      coalesce(prev);
+      n = as_node(prev);
+    } else {
+      coalesce(n);
+    }
+  }
+  if (index == n->count) return iterator(n->next, 0);
+  return iterator(n, index);
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::push_back(const_reference value) {
+  emplace(end(), value);
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::push_back(value_type &&value) {
+  emplace(end(), std::move(value));
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::pop_back() {
+  node *n = as_node(sentinel_.prev);
+  --n->count;
+  std::destroy_at(n->data() + n->count);
+  --size_;
+  if (n->count == 0) {
+    unlink_chain(n, n);
+    destroy_node(n);
+  }
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::push_front(const_reference value) {
+  emplace(begin(), value);
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::push_front(value_type &&value) {
+  emplace(begin(), std::move(value));
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::pop_front() {
+  erase(begin());
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::swap(unrolled_list &other) noexcept {
+  link chain;
+  take_chain(sentinel_, chain);
+  take_chain(other.sentinel_, sentinel_);
+  take_chain(chain, other.sentinel_);
+  std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::merge(unrolled_list &other) {
+  merge(other, std::less<T>());
+}
+
+// Moves the merged elements into fresh nodes at the back of *this, freeing
+// each source node as soon as it is drained, so at most one extra node is
+// live. Once either side runs out the rest of the other is relinked whole.
+template <class T, std::size_t K, class Allocator>
+template <class Compare>
+void unrolled_list<T, K, Allocator>::merge(unrolled_list &other, Compare comp) {
+  if (&other == this || other.empty()) return;
+  size_type total = size_ + other.size_;
+  link left, right;
+  take_chain(sentinel_, left);
+  take_chain(other.sentinel_, right);
+  other.size_ = 0;
+  iterator a(left.next, 0), b(right.next, 0);
+  auto consume = [this](iterator &it) {
+    push_back(std::move(*it));
+    node *n = as_node(it.node_);
+    if (++it.index_ == n->count) {
+      it = iterator(n->next, 0);
+      unlink_chain(n, n);
+      destroy_node(n);
+    }
+  };
+  while (a.node_ != &left && b.node_ != &right) {
+    consume(comp(*b, *a) ? b : a);
+  }
+  link *rest = a.node_ != &left ? &left : &right;
+  iterator &it = a.node_ != &left ? a : b;
+  while (it.index_ != 0) consume(it);
+  if (it.node_ != rest) {
+    link *join = sentinel_.prev;
+    link *first = rest->next, *last = rest->prev;
+    rest->next = rest->prev = rest;
+    link_chain(&sentinel_, first, last);
+    coalesce(join);
+  }
+  size_ = total;
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::splice(const_iterator pos,
+                                            unrolled_list &other) {
+  if (&other == this || other.empty()) return;
+  link *at = split(pos, nullptr).node_;
+  link *first = other.sentinel_.next, *last = other.sentinel_.prev;
+  other.sentinel_.next = other.sentinel_.prev = &other.sentinel_;
+  link *before = at->prev;
+  link_chain(at, first, last);
+  size_ += std::exchange(other.size_, 0);
+  coalesce(last);
+  coalesce(before);
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::splice(const_iterator pos,
+                                            unrolled_list &other,
+                                            const_iterator it) {
+  splice(pos, other, it, std::next(it));
+}
+
+// Cuts other at last and first (keeping pos valid when it shares a node
+// with either), cuts *this at pos, moves the whole nodes in between, then
+// lets the nodes on each side of both seams absorb their neighbours.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::splice(const_iterator pos,
+                                            unrolled_list &other,
+                                            const_iterator first,
+                                            const_iterator last) {
+  if (first == last || (&other == this && (pos == first || pos == last))) {
+    return;
+  }
+  const_iterator at = pos;
+  link *end_cut = other.split(last, &at).node_;
+  link *chain_first = other.split(first, &at).node_;
+  link *chain_last = end_cut->prev;
+  link *at_node = split(at, nullptr).node_;
+  if (&other != this) {
+    size_type moved = 0;
+    for (link *l = chain_first;; l = l->next) {
+      moved += as_node(l)->count;
+      if (l == chain_last) break;
+    }
+    size_ += moved;
+    other.size_ -= moved;
+  }
+  link *hole = chain_first->prev;
+  unlink_chain(chain_first, chain_last);
+  other.coalesce(hole);
+  link *before = at_node->prev;
+  link_chain(at_node, chain_first, chain_last);
+  coalesce(chain_last);
+  coalesce(before);
+}
+
+// Reverses the order of the nodes by swapping every link pair, sentinel
+// included, and the elements within each node in place.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::reverse() {
+  link *l = &sentinel_;
+  do {
+    std::swap(l->next, l->prev);
+    if (l != &sentinel_) {
+      node *n = as_node(l);
+      std::reverse(n->data(), n->data() + n->count);
+    }
+    l = l->prev;
+  } while (l != &sentinel_);
+}
+
+// Compacts the kept elements towards the front, keeping every node's count,
+// then drops what is left past the last one.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::unique() {
+  if (size_ < 2) return;
+  iterator write = begin();
+  for (iterator read = std::next(write); read != end(); ++read) {
+    if (*read == *write) continue;
+    ++write;
+    if (write != read) *write = std::move(*read);
+  }
+  ++write;
+  link *l = write.node_;
+  if (write.index_ != 0) {
+    node *n = as_node(l);
+    std::destroy(n->data() + write.index_, n->data() + n->count);
+    size_ -= n->count - write.index_;
+    n->count = write.index_;
+    l = l->next;
+  }
+  while (l != &sentinel_) {
+    link *next = l->next;
+    size_ -= as_node(l)->count;
+    unlink_chain(l, l);
+    destroy_node(as_node(l));
+    l = next;
+  }
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::sort() {
+  sort(std::less<T>());
+}
+
+template <class T, std::size_t K, class Allocator>
+template <class Compare>
+void unrolled_list<T, K, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  s21::vector<T> buffer;
+  buffer.reserve(size_);
+  for (reference item : *this) buffer.push_back(std::move(item));
+  std::stable_sort(buffer.begin(), buffer.end(), comp);
+  T *sorted = buffer.begin();
+  for (reference item : *this) item = std::move(*sorted++);
+}
+
+// Modifiers DOP
+
+template <class T, std::size_t K, class Allocator>
+template <class... Args>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::insert_many(const_iterator pos,
+                                            Args &&...args) {
+  ((pos = std::next(emplace(pos, std::forward<Args>(args)))), ...);
+  return iterator(pos.node_, pos.index_);
+}
+
+template <class T, std::size_t K, class Allocator>
+template <class... Args>
+void unrolled_list<T, K, Allocator>::insert_many_back(Args &&...args) {
+  (emplace(end(), std::forward<Args>(args)), ...);
+}
+
+template <class T, std::size_t K, class Allocator>
+template <class... Args>
+void unrolled_list<T, K, Allocator>::insert_many_front(Args &&...args) {
+  (emplace(begin(), std::forward<Args>(args)), ...);
+}
+
+// Links
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::link_chain(link *pos, link *first,
+                                                link *last) {
+  first->prev = pos->prev;
+  pos->prev->next = first;
+  last->next = pos;
+  pos->prev = last;
+}
+
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::unlink_chain(link *first, link *last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+// Moves the nodes hanging off sentinel from to sentinel to, leaving from
+// empty.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::take_chain(link &from, link &to) {
+  if (from.next == &from) {
+    to.next = to.prev = &to;
+    return;
+  }
+  to.next = from.next;
+  to.prev = from.prev;
+  to.next->prev = &to;
+  to.prev->next = &to;
+  from.next = from.prev = &from;
+}
+
+// Nodes
+
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::node *
+unrolled_list<T, K, Allocator>::create_node(link *pos) {
+  node *n = node_traits::allocate(alloc_, 1);
+  ::new (static_cast<void *>(n)) node;
+  n->count = 0;
+  link_chain(pos, n, n);
+  return n;
+}
+
+// Destroys the node's elements and frees it; the caller unlinks it.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::destroy_node(node *n) {
+  std::destroy(n->data(), n->data() + n->count);
+  node_traits::deallocate(alloc_, n, 1);
+}
+
+// Moves the elements from it to the end of its node into a new node after
+// it and returns its new position, the start of that node. At a node
+// boundary there is nothing to cut and it comes back unchanged. If track
+// points into the moved part it is moved along with it.
+template <class T, std::size_t K, class Allocator>
+typename unrolled_list<T, K, Allocator>::iterator
+unrolled_list<T, K, Allocator>::split(const_iterator it,
+                                      const_iterator *track) {
+  if (it.node_ == &sentinel_ || it.index_ == 0) {
+    return iterator(it.node_, 0);
+  }
+  node *n = as_node(it.node_);
+  node *m = create_node(n->next);
+  T *cut = n->data() + it.index_;
+  std::uninitialized_move(cut, n->data() + n->count, m->data());
+  std::destroy(cut, n->data() + n->count);
+  m->count = n->count - it.index_;
+  n->count = it.index_;
+  if (track && track->node_ == n && track->index_ >= it.index_) {
+    *track = const_iterator(m, track->index_ - it.index_);
+  }
+  return iterator(m, 0);
+}
+
+// Moves l's successor into l when both are nodes and fit in one.
+template <class T, std::size_t K, class Allocator>
+void unrolled_list<T, K, Allocator>::coalesce(link *l) {
+  if (l == &sentinel_ || l->next == &sentinel_) return;
+  node *a = as_node(l), *b = as_node(l->next);
+  if (a->count + b->count > K) return;
+  std::uninitialized_move(b->data(), b->data() + b->count,
+                          a->data() + a->count);
+  a->count += b->count;
+  unlink_chain(b, b);
+  destroy_node(b);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNROLLED_LIST_H
@@ -0,0 +1,223 @@
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../allocator/s21_allocator.h"
+#include "gtest/gtest.h"
+#include "s21_unrolled_list.h"
+
+namespace {
+
+template <class List>
+std::vector<typename List::value_type> to_std(const List &l) {
+  return std::vector<typename List::value_type>(l.begin(), l.end());
+}
+
+template <class List>
+std::vector<typename List::value_type> to_std_backwards(const List &l) {
+  std::vector<typename List::value_type> out;
+  for (auto it = l.end(); it != l.begin();) out.push_back(*--it);
+  return out;
+}
+
+// Orders by the first field only, so equal keys with different payloads
+// show whether an operation is stable.
+struct by_first {
+  bool operator()(const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) const {
+    return a.first < b.first;
+  }
+};
+
+}  // namespace
+
+TEST(unrolled_list_suite, default_node_capacity_fills_256_bytes) {
+  EXPECT_EQ(s21::unrolled_list<int>::kNodeCapacity, static_cast<size_t>(58));
+  EXPECT_EQ(s21::unrolled_list<double>::kNodeCapacity, static_cast<size_t>(29));
+  struct big {
+    char bytes[1000];
+  };
+  EXPECT_EQ(s21::unrolled_list<big>::kNodeCapacity, static_cast<size_t>(4));
+}
+
+TEST(unrolled_list_suite, push_and_pop_at_both_ends) {
+  s21::unrolled_list<int, 8> l;
+  EXPECT_TRUE(l.empty());
+  for (int i = 0; i < 100; ++i) l.push_back(i);
+  EXPECT_EQ(l.size(), static_cast<size_t>(100));
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(13));
+  for (int i = 1; i <= 20; ++i) l.push_front(-i);
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(16));
+  EXPECT_EQ(l.front(), -20);
+  EXPECT_EQ(l.back(), 99);
+  std::vector<int> expected;
+  for (int i = -20; i < 100; ++i) expected.push_back(i);
+  EXPECT_EQ(to_std(l), expected);
+  EXPECT_EQ(to_std_backwards(l),
+            std::vector<int>(expected.rbegin(), expected.rend()));
+  while (!l.empty()) {
+    l.pop_front();
+    if (!l.empty()) l.pop_back();
+  }
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(0));
+  EXPECT_EQ(l.begin(), l.end());
+}
+
+TEST(unrolled_list_suite, matches_std_list_under_random_edits) {
+  s21::unrolled_list<int, 4> l;
+  std::list<int> expected;
+  std::mt19937 rng(17);
+  for (int round = 0; round < 3000; ++round) {
+    std::size_t at = expected.empty() ? 0 : rng() % (expected.size() + 1);
+    auto it = std::next(l.begin(), at);
+    auto expected_it = std::next(expected.begin(), at);
+    if (rng() % 5 < 3 || at == expected.size()) {
+      int v = static_cast<int>(rng() % 1000);
+      EXPECT_EQ(*l.insert(it, v), v);
+      expected.insert(expected_it, v);
+    } else {
+      auto next = l.erase(it);
+      auto expected_next = expected.erase(expected_it);
+      if (expected_next != expected.end()) {
+        EXPECT_EQ(*next, *expected_next);
+      }
+      EXPECT_EQ(next == l.end(), expected_next == expected.end());
+    }
+    ASSERT_EQ(l.size(), expected.size());
+  }
+  EXPECT_EQ(to_std(l), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_EQ(to_std_backwards(l),
+            std::vector<int>(expected.rbegin(), expected.rend()));
+}
+
+TEST(unrolled_list_suite, erase_merges_underfull_nodes) {
+  s21::unrolled_list<int, 4> l;
+  for (int i = 0; i < 16; ++i) l.push_back(i);
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(4));
+  auto it = l.begin();
+  it = l.erase(it);
+  it = l.erase(it);
+  it = l.erase(it);
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(4));
+  it = l.erase(std::next(it));
+  it = l.erase(it);
+  EXPECT_EQ(*it, 6);
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(4));
+  it = l.erase(it);
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(l.node_count(), static_cast<size_t>(3));
+  EXPECT_EQ(to_std(l), std::vector<int>({3, 7, 8, 9, 10, 11, 12, 13, 14, 15}));
+}
+
+TEST(unrolled_list_suite, splice_whole_single_and_range) {
+  s21::unrolled_list<int, 4> a = {1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> b = {10, 11, 12, 13, 14};
+  a.splice(std::next(a.begin(), 3), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(to_std(a),
+            std::vector<int>({1, 2, 3, 10, 11, 12, 13, 14, 4, 5, 6}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(11));
+
+  b.splice(b.end(), a, std::next(a.begin(), 4));
+  EXPECT_EQ(to_std(b), std::vector<int>({11}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(10));
+
+  b.splice(b.begin(), a, std::next(a.begin()), std::next(a.begin(), 6));
+  EXPECT_EQ(to_std(b), std::vector<int>({2, 3, 10, 12, 13, 11}));
+  EXPECT_EQ(to_std(a), std::vector<int>({1, 14, 4, 5, 6}));
+  EXPECT_EQ(to_std_backwards(a), std::vector<int>({6, 5, 4, 14, 1}));
+  EXPECT_EQ(a.size(), static_cast<size_t>(5));
+  EXPECT_EQ(b.size(), static_cast<size_t>(6));
+
+  // Within one list: move the tail to the front.
+  b.splice(b.begin(), b, std::next(b.begin(), 4), b.end());
+  EXPECT_EQ(to_std(b), std::vector<int>({13, 11, 2, 3, 10, 12}));
+  b.splice(b.end(), b, b.begin());
+  EXPECT_EQ(to_std(b), std::vector<int>({11, 2, 3, 10, 12, 13}));
+  EXPECT_EQ(to_std_backwards(b), std::vector<int>({13, 12, 10, 3, 2, 11}));
+  EXPECT_EQ(b.size(), static_cast<size_t>(6));
+}
+
+TEST(unrolled_list_suite, sort_and_merge_are_stable) {
+  s21::unrolled_list<std::pair<int, int>, 3> a, b;
+  std::vector<std::pair<int, int>> expected;
+  std::mt19937 rng(3);
+  for (int i = 0; i < 200; ++i) {
+    std::pair<int, int> v(static_cast<int>(rng() % 20), i);
+    (i % 3 == 0 ? b : a).push_back(v);
+    expected.push_back(v);
+  }
+  a.sort(by_first());
+  b.sort(by_first());
+  a.merge(b, by_first());
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), static_cast<size_t>(200));
+  std::vector<std::pair<int, int>> merged = to_std(a);
+  for (std::size_t i = 1; i < merged.size(); ++i) {
+    ASSERT_LE(merged[i - 1].first, merged[i].first);
+  }
+  // Among equal keys a's elements come first, each side in push order.
+  for (std::size_t i = 1; i < merged.size(); ++i) {
+    if (merged[i - 1].first != merged[i].first) continue;
+    bool prev_from_b = merged[i - 1].second % 3 == 0;
+    bool from_b = merged[i].second % 3 == 0;
+    EXPECT_TRUE(!prev_from_b || from_b);
+    if (prev_from_b == from_b) {
+      EXPECT_LT(merged[i - 1].second, merged[i].second);
+    }
+  }
+
+  s21::unrolled_list<int, 4> c = {1, 4, 9}, d = {2, 3, 5, 6, 7, 8, 10, 11};
+  c.merge(d);
+  EXPECT_EQ(to_std(c), std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}));
+  EXPECT_EQ(to_std_backwards(c),
+            std::vector<int>({11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}));
+}
+
+TEST(unrolled_list_suite, unique_and_reverse) {
+  s21::unrolled_list<std::string, 3> l = {"a", "a", "b", "b", "b", "c",
+                                          "a", "d", "d", "d", "d"};
+  l.unique();
+  EXPECT_EQ(to_std(l), std::vector<std::string>({"a", "b", "c", "a", "d"}));
+  EXPECT_EQ(l.size(), static_cast<size_t>(5));
+  l.reverse();
+  EXPECT_EQ(to_std(l), std::vector<std::string>({"d", "a", "c", "b", "a"}));
+  EXPECT_EQ(to_std_backwards(l),
+            std::vector<std::string>({"a", "b", "c", "a", "d"}));
+  l.push_back("e");
+  EXPECT_EQ(l.back(), "e");
+}
+
+TEST(unrolled_list_suite, insert_many_copy_move_and_pool) {
+  s21::unrolled_list<int, 4> l = {1, 5};
+  auto it = l.insert_many(std::next(l.begin()), 2, 3, 4);
+  EXPECT_EQ(*it, 5);
+  l.insert_many_back(6, 7);
+  l.insert_many_front(0, -1);
+  EXPECT_EQ(to_std(l), std::vector<int>({-1, 0, 1, 2, 3, 4, 5, 6, 7}));
+
+  s21::unrolled_list<int, 4> copy(l);
+  s21::unrolled_list<int, 4> moved(std::move(l));
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(to_std(copy), to_std(moved));
+  l = copy;
+  copy.clear();
+  l.swap(copy);
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(copy.size(), static_cast<size_t>(9));
+
+  s21::unrolled_list<int, 16, s21::pool_allocator<int>> pooled;
+  for (int i = 0; i < 1000; ++i) pooled.push_back(i);
+  pooled.sort(std::greater<int>());
+  EXPECT_EQ(pooled.front(), 999);
+  EXPECT_EQ(pooled.back(), 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
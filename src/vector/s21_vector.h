@@ -1,16 +1,122 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_VECTOR_H
 #define CPP2_S21_CONTAINERS_1_S21_VECTOR_H
 
+#include <algorithm>
 #include <cstring>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
+template <class T, class Allocator = std::allocator<T>>
+class vector;
+
+// Types whose objects may be moved to a new address with a plain memcpy,
+// without running the move constructor and destructor. Specialize for types
+// that own resources only through pointers that stay valid after the move.
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <class T, class Allocator>
+struct is_trivially_relocatable<vector<T, Allocator>>
+    : std::bool_constant<std::is_empty_v<Allocator> ||
+                         is_trivially_relocatable<Allocator>::value> {};
+
+// Builds [first, last) at dest: memcpy for trivially relocatable types,
+// otherwise move construction, falling back to copies when the move could
+// throw. On failure dest holds nothing and the source is left intact.
+template <class T>
+void uninitialized_relocate(T *first, T *last, T *dest) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<void *>(first),
+                  (last - first) * sizeof(T));
+    }
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    std::uninitialized_move(first, last, dest);
+  } else {
+    std::uninitialized_copy(first, last, dest);
+  }
+}
+
+// Ends the source side of an uninitialized_relocate(). Memcpy'd objects now
+// live at the destination, so their old copies must not be destroyed.
 template <class T>
+void destroy_relocated(T *first, T *last) {
+  if constexpr (!is_trivially_relocatable<T>::value &&
+                !std::is_trivially_destructible_v<T>) {
+    std::destroy(first, last);
+  }
+}
+
+namespace internal {
+
+// Inserts count elements read from first before begin + index when the
+// storage already has room for them, shifting the tail in place. size is
+// bumped as each run of elements is constructed, so it only ever counts live
+// objects if a copy throws.
+template <class T, class InputIt>
+void insert_in_place(T *begin, std::size_t &size, std::size_t index,
+                     InputIt first, std::size_t count) {
+  T *pos = begin + index;
+  T *old_end = begin + size;
+  std::size_t tail = size - index;
+  if (tail > count) {
+    std::uninitialized_move(old_end - count, old_end, old_end);
+    size += count;
+    std::move_backward(pos, old_end - count, old_end);
+    std::copy_n(first, count, pos);
+  } else {
+    InputIt mid = std::next(first, tail);
+    std::uninitialized_copy_n(mid, count - tail, old_end);
+    size += count - tail;
+    std::uninitialized_move(pos, old_end, pos + count);
+    size += tail;
+    std::copy_n(first, tail, pos);
+  }
+}
+
+// Fills fresh storage new_begin with [begin, begin + size) plus count
+// elements read from first before index. The new elements are built first,
+// so first may point into the old storage. On failure new_begin holds
+// nothing and the old elements are intact; the caller frees either block.
+template <class T, class InputIt>
+void insert_relocating(T *begin, std::size_t size, T *new_begin,
+                       std::size_t index, InputIt first, std::size_t count) {
+  T *gap = new_begin + index;
+  std::uninitialized_copy_n(first, count, gap);
+  try {
+    uninitialized_relocate(begin, begin + index, new_begin);
+    try {
+      uninitialized_relocate(begin + index, begin + size, gap + count);
+    } catch (...) {
+      std::destroy(new_begin, gap);
+      throw;
+    }
+  } catch (...) {
+    std::destroy(gap, gap + count);
+    throw;
+  }
+}
+
+}  // namespace internal
+
+// Storage comes from Allocator (std::allocator by default; see
+// allocator/s21_allocator.h for aligned and huge-page allocators). The
+// allocator travels with the elements on copy, move and swap.
+template <class T, class Allocator>
 class vector {
  public:
   //  Vector Member type
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -19,40 +125,56 @@ class vector {
 
   //  Vector Member functions
   vector();
-  vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
+  explicit vector(const Allocator &alloc);
+  vector(size_type n, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
   vector(const vector &v);
   vector(vector &&v) noexcept;
   ~vector();
 
+  vector &operator=(const vector &v);
   vector &operator=(vector &&v) noexcept;
 
   //  Vector Element access
   reference at(size_type pos);
   reference operator[](size_type pos);
-  const_reference front();
-  const_reference back();
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
   T *data();
+  const T *data() const;
+  allocator_type get_allocator() const;
 
   //  Vector Iterators
   iterator begin();
   iterator end();
 
   //  Vector Capacity
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
   void reserve(size_type size);
-  size_type capacity();
+  size_type capacity() const;
   void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void resize_default_init(size_type count);
 
   //  Modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  template <class ForwardIt>
+  iterator insert(iterator pos, ForwardIt first, ForwardIt last);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(vector &other);
+  void assign(size_type count, const_reference value);
+  template <class ForwardIt>
+  void append(ForwardIt first, ForwardIt last);
 
   void fill();
 
@@ -66,282 +188,527 @@ class vector {
   size_type size_{};
   size_type capacity_{};
   T *begin_{};
+  Allocator alloc_{};
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n);
+  static void destroy(T *first, T *last);
 
-  void redistribute();
+  size_type next_capacity(size_type min_capacity);
+  void reallocate(size_type new_capacity);
+  template <typename... Args>
+  void realloc_append(Args &&...args);
+  template <class InputIt>
+  iterator insert_range(size_type index, InputIt first, size_type count);
 };
 
 // CONSTRUCTOR
 
-template <class T>
-vector<T>::vector() = default;
-
-template <class T>
-vector<T>::vector(vector::size_type n) {
-  begin_ = new T[n];
+template <class T, class Allocator>
+vector<T, Allocator>::vector() = default;
+
+template <class T, class Allocator>
+vector<T, Allocator>::vector(const Allocator &alloc) : alloc_(alloc) {}
+
+template <class T, class Allocator>
+vector<T, Allocator>::vector(vector::size_type n, const Allocator &alloc)
+    : alloc_(alloc) {
+  begin_ = allocate(n);
+  try {
+    std::uninitialized_value_construct_n(begin_, n);
+  } catch (...) {
+    deallocate(begin_, n);
+    throw;
+  }
   capacity_ = n;
   size_ = n;
 }
 
-template <class T>
-vector<T>::vector(const std::initializer_list<value_type> &items)
-    : vector(items.size()) {
-  std::copy(items.begin(), items.end(), begin_);
+template <class T, class Allocator>
+vector<T, Allocator>::vector(
+    const std::initializer_list<value_type> &items, const Allocator &alloc)
+    : alloc_(alloc) {
+  begin_ = allocate(items.size());
+  try {
+    std::uninitialized_copy(items.begin(), items.end(), begin_);
+  } catch (...) {
+    deallocate(begin_, items.size());
+    throw;
+  }
+  capacity_ = items.size();
+  size_ = items.size();
 }
 
-template <class T>
-vector<T>::vector(const vector &v) : size_(v.size_), capacity_(v.capacity_) {
-  begin_ = new T[capacity_];
-  std::memcpy(begin_, v.begin_, v.size_ * sizeof(T));
+template <class T, class Allocator>
+vector<T, Allocator>::vector(const vector &v)
+    : alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  begin_ = allocate(v.size_);
+  try {
+    std::uninitialized_copy(v.begin_, v.begin_ + v.size_, begin_);
+  } catch (...) {
+    deallocate(begin_, v.size_);
+    throw;
+  }
+  capacity_ = v.size_;
+  size_ = v.size_;
 }
 
-template <class T>
-vector<T>::vector(vector &&v) noexcept {
-  if (this != &v) {
-    if (begin_) {
-      delete[] begin_;
-    }
-    begin_ = nullptr;
-    capacity_ = 0;
-    size_ = 0;
-    std::swap(size_, v.size_);
-    std::swap(capacity_, v.capacity_);
-    std::swap(begin_, v.begin_);
-  }
+template <class T, class Allocator>
+vector<T, Allocator>::vector(vector &&v) noexcept
+    : size_(v.size_),
+      capacity_(v.capacity_),
+      begin_(v.begin_),
+      alloc_(std::move(v.alloc_)) {
+  v.begin_ = nullptr;
+  v.capacity_ = 0;
+  v.size_ = 0;
 }
 
-template <class T>
-vector<T>::~vector() {
+template <class T, class Allocator>
+vector<T, Allocator>::~vector() {
   clear();
 }
 
-template <class T>
-void vector<T>::clear() {
-  delete[] begin_;
+template <class T, class Allocator>
+void vector<T, Allocator>::clear() {
+  destroy(begin_, begin_ + size_);
+  deallocate(begin_, capacity_);
   begin_ = nullptr;
   size_ = 0;
   capacity_ = 0;
 }
 
-template <class T>
-typename s21::vector<T> &s21::vector<T>::operator=(vector<T> &&v) noexcept {
-  if (begin_) {
-    delete[] begin_;
+template <class T, class Allocator>
+typename s21::vector<T, Allocator> &s21::vector<T, Allocator>::operator=(
+    const vector<T, Allocator> &v) {
+  if (this != &v) {
+    vector<T, Allocator> copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class T, class Allocator>
+typename s21::vector<T, Allocator> &s21::vector<T, Allocator>::operator=(
+    vector<T, Allocator> &&v) noexcept {
+  if (this != &v) {
+    clear();
+    std::swap(begin_, v.begin_);
+    std::swap(size_, v.size_);
+    std::swap(capacity_, v.capacity_);
+    std::swap(alloc_, v.alloc_);
   }
-  begin_ = nullptr;
-  capacity_ = 0;
-  size_ = 0;
-  std::swap(begin_, v.begin_);
-  std::swap(size_, v.size_);
-  std::swap(capacity_, v.capacity_);
   return *this;
 }
 
 //  Vector Element access
 
-template <class T>
-T &vector<T>::at(vector::size_type pos) {
-  if (pos > size_) {
+template <class T, class Allocator>
+T &vector<T, Allocator>::at(vector::size_type pos) {
+  if (pos >= size_) {
     throw std::out_of_range("out_of_range");
   }
   return begin_[pos];
 }
 
-template <class T>
-T &vector<T>::operator[](vector::size_type pos) {
+template <class T, class Allocator>
+T &vector<T, Allocator>::operator[](vector::size_type pos) {
   return begin_[pos];
 }
 
-template <class T>
-const T &vector<T>::front() {
+template <class T, class Allocator>
+const T &vector<T, Allocator>::operator[](vector::size_type pos) const {
+  return begin_[pos];
+}
+
+template <class T, class Allocator>
+const T &vector<T, Allocator>::front() const {
   return begin_[0];
 }
 
-template <class T>
-const T &vector<T>::back() {
+template <class T, class Allocator>
+const T &vector<T, Allocator>::back() const {
   return begin_[size_ - 1];
 }
 
-template <class T>
-T *vector<T>::data() {
+template <class T, class Allocator>
+T *vector<T, Allocator>::data() {
+  return begin_;
+}
+
+template <class T, class Allocator>
+const T *vector<T, Allocator>::data() const {
   return begin_;
 }
 
+template <class T, class Allocator>
+typename vector<T, Allocator>::allocator_type
+vector<T, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
 // Iterator
 
-template <class T>
-typename s21::vector<T>::iterator vector<T>::begin() {
+template <class T, class Allocator>
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::begin() {
   return begin_;
 }
 
-template <class T>
-typename s21::vector<T>::iterator vector<T>::end() {
+template <class T, class Allocator>
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::end() {
   return begin_ + size_;
 }
 
 //  Vector Capacity
 
-template <class T>
-bool vector<T>::empty() {
-  return this->begin() == this->end();
+template <class T, class Allocator>
+bool vector<T, Allocator>::empty() const {
+  return size_ == 0;
 }
 
-template <class T>
-typename vector<T>::size_type vector<T>::size() {
+template <class T, class Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const {
   return size_;
 }
 
-template <class T>
-size_t vector<T>::max_size() {
-  return std::numeric_limits<size_t>::max() / sizeof(T);
+template <class T, class Allocator>
+size_t vector<T, Allocator>::max_size() const {
+  return std::min<size_t>(std::numeric_limits<size_t>::max() / sizeof(T),
+                          alloc_traits::max_size(alloc_));
 }
 
-template <class T>
-void vector<T>::reserve(vector::size_type size) {
+template <class T, class Allocator>
+void vector<T, Allocator>::reserve(vector::size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("length_error");
+  }
   if (capacity_ < size) {
-    capacity_ = size;
-    T *new_array = new T[capacity_];
-    std::memcpy(new_array, begin_, size_ * sizeof(T));
-    delete begin_;
-    begin_ = new T[capacity_];
-    std::memcpy(begin_, new_array, size_ * sizeof(T));
-    delete[] new_array;
+    reallocate(size);
   }
 }
 
-template <class T>
-typename vector<T>::size_type vector<T>::capacity() {
+template <class T, class Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::capacity()
+    const {
   return capacity_;
 }
 
-template <class T>
-void vector<T>::shrink_to_fit() {
+template <class T, class Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
   if (size_ != capacity_) {
-    T *temp = new T[size_];
-    capacity_ = size_;
-    std::memcpy(temp, begin_, size_ * sizeof(T));
-    delete begin_;
-    begin_ = temp;
+    reallocate(size_);
+  }
+}
+
+// New elements are value-initialized (zeroed for arithmetic types).
+template <class T, class Allocator>
+void vector<T, Allocator>::resize(size_type count) {
+  if (count <= size_) {
+    erase(begin_ + count, end());
+  } else {
+    if (count > capacity_) {
+      reserve(next_capacity(count));
+    }
+    std::uninitialized_value_construct(begin_ + size_, begin_ + count);
+    size_ = count;
+  }
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::resize(size_type count, const_reference value) {
+  if (count <= size_) {
+    erase(begin_ + count, end());
+  } else {
+    // value may live in the storage that reserve() is about to free.
+    value_type copy(value);
+    if (count > capacity_) {
+      reserve(next_capacity(count));
+    }
+    std::uninitialized_fill(begin_ + size_, begin_ + count, copy);
+    size_ = count;
+  }
+}
+
+// Like resize(), but new elements are default-initialized: trivial types are
+// left unwritten, so a buffer about to be overwritten by I/O costs no memset.
+template <class T, class Allocator>
+void vector<T, Allocator>::resize_default_init(size_type count) {
+  if (count <= size_) {
+    erase(begin_ + count, end());
+  } else {
+    if (count > capacity_) {
+      reserve(next_capacity(count));
+    }
+    std::uninitialized_default_construct(begin_ + size_, begin_ + count);
+    size_ = count;
   }
 }
 
 // Modifiers
 
-template <class T>
-typename s21::vector<T>::iterator vector<T>::insert(vector::iterator pos,
-                                                    const_reference value) {
+template <class T, class Allocator>
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    vector::iterator pos, const_reference value) {
+  size_type index = pos - begin_;
   if (pos == end()) {
     push_back(value);
-  } else if (pos == begin_) {
-    T *temp = new T[capacity_ + 1]();
-    begin_[0] = value;
-    std::memcpy(temp + 1, begin_, size_ * sizeof(T));
-    ++size_;
-    redistribute();
-    std::memcpy(begin_, temp, size_ * sizeof(T));
-    delete[] temp;
   } else {
-    T *temp = new T[capacity_ + 1]();
-    long int insert = pos - begin_;
-    size_t start = (pos - begin_) * sizeof(T);
-    size_t stop = (end() - pos + 1) * sizeof(T);
-    std::memcpy(temp, begin_, start);
-    temp[pos - begin_] = value;
-    std::memcpy(temp + insert + 1, pos, stop);
-    ++size_;
-    redistribute();
-    std::memcpy(begin_, temp, size_ * sizeof(T));
-    pos = insert + begin_;
-    delete[] temp;
-  }
-  return pos;
+    // value may refer to an element that is about to be shifted.
+    value_type copy(value);
+    insert_range(index, std::make_move_iterator(&copy), 1);
+  }
+  return begin_ + index;
 }
 
-template <class T>
-void vector<T>::erase(vector::iterator pos) {
-  T *temp = new T[capacity_];
-  int del_pos = pos - begin_;
-  size_t start = sizeof(T) * del_pos;
-  size_--;
-  size_t position = sizeof(T) * (begin_ + size_ - pos);
-  size_t end = position;
-  std::memcpy(temp, begin_, start);
-  std::memcpy(temp + del_pos, begin_ + del_pos + 1, end);
-  std::memcpy(begin_, temp, size_ * sizeof(T));
-  delete[] temp;
+template <class T, class Allocator>
+template <class ForwardIt>
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    vector::iterator pos, ForwardIt first, ForwardIt last) {
+  static_assert(
+      std::is_base_of_v<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<ForwardIt>::iterator_category>,
+      "insert requires forward iterators");
+  return insert_range(pos - begin_, first, std::distance(first, last));
 }
 
-template <class T>
-void vector<T>::push_back(const_reference value) {
-  redistribute();
-  begin_[size_] = value;
-  size_++;
+template <class T, class Allocator>
+void vector<T, Allocator>::erase(vector::iterator pos) {
+  erase(pos, pos + 1);
 }
 
-template <class T>
-void vector<T>::pop_back() {
-  erase(end() - 1);
+// The tail is moved down once, over the whole erased range.
+template <class T, class Allocator>
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::erase(
+    vector::iterator first, vector::iterator last) {
+  if (first != last) {
+    iterator new_end = std::move(last, end(), first);
+    destroy(new_end, end());
+    size_ = new_end - begin_;
+  }
+  return first;
 }
 
-template <class T>
-void vector<T>::swap(vector &other) {
+template <class T, class Allocator>
+void vector<T, Allocator>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    realloc_append(value);
+  } else {
+    ::new (static_cast<void *>(begin_ + size_)) T(value);
+    size_++;
+  }
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::push_back(value_type &&value) {
+  if (size_ == capacity_) {
+    realloc_append(std::move(value));
+  } else {
+    ::new (static_cast<void *>(begin_ + size_)) T(std::move(value));
+    size_++;
+  }
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::pop_back() {
+  --size_;
+  destroy(begin_ + size_, begin_ + size_ + 1);
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::swap(vector &other) {
   std::swap(capacity_, other.capacity_);
   std::swap(size_, other.size_);
   std::swap(begin_, other.begin_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template <class T>
-void vector<T>::redistribute() {
-  if (!size_ && !capacity_) {
-    capacity_ = 1;
-  } else if (size_ == capacity_) {
-    capacity_ = (size_t)(capacity_ * 2);
+// Replaces the contents with count copies of value. When the current
+// storage is too small it is dropped rather than relocated, since none of
+// the old elements survive.
+template <class T, class Allocator>
+void vector<T, Allocator>::assign(size_type count, const_reference value) {
+  value_type copy(value);
+  destroy(begin_, begin_ + size_);
+  size_ = 0;
+  if (count > capacity_) {
+    if (count > max_size()) {
+      throw std::length_error("length_error");
+    }
+    deallocate(begin_, capacity_);
+    begin_ = nullptr;
+    capacity_ = 0;
+    begin_ = allocate(count);
+    capacity_ = count;
   }
-  T *temp = new T[capacity_];
-  std::memcpy(temp, begin_, size_ * sizeof(T));
-  delete begin_;
-  begin_ = new T[capacity_];
-  std::memcpy(begin_, temp, size_ * sizeof(T));
-  delete[] temp;
+  std::uninitialized_fill_n(begin_, count, copy);
+  size_ = count;
 }
 
-template <class T>
-void vector<T>::fill() {
+template <class T, class Allocator>
+template <class ForwardIt>
+void vector<T, Allocator>::append(ForwardIt first, ForwardIt last) {
+  static_assert(
+      std::is_base_of_v<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<ForwardIt>::iterator_category>,
+      "append requires forward iterators");
+  size_type count = std::distance(first, last);
+  if (size_ + count > capacity_) {
+    reserve(next_capacity(size_ + count));
+  }
+  std::uninitialized_copy_n(first, count, begin_ + size_);
+  size_ += count;
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::fill() {
   for (size_t i = 0; i < size_; i++) {
     begin_[i] = i + 10;
   }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <typename... Args>
-typename s21::vector<T>::iterator vector<T>::insert_many(const_iterator pos,
-                                                         Args &&...args) {
-  size_t countEl = sizeof...(args);
-  size_t it = pos - begin_;
+typename s21::vector<T, Allocator>::iterator vector<T, Allocator>::insert_many(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - begin_;
+  if constexpr (sizeof...(args) == 0) {
+    return begin_ + index;
+  } else {
+    T temp[] = {T(std::forward<Args>(args))...};
+    return insert_range(index, std::make_move_iterator(temp), sizeof...(args));
+  }
+}
 
-  if (size_ + countEl > capacity_) {
-    redistribute();
+template <class T, class Allocator>
+template <typename... Args>
+void vector<T, Allocator>::insert_many_back(Args &&...args) {
+  if constexpr (sizeof...(args) != 0) {
+    // Materialized first, so args may refer into the storage reserve() frees.
+    T temp[] = {T(std::forward<Args>(args))...};
+    if (size_ + sizeof...(args) > capacity_) {
+      reserve(next_capacity(size_ + sizeof...(args)));
+    }
+    std::uninitialized_move(std::begin(temp), std::end(temp), end());
+    size_ += sizeof...(args);
   }
-  std::memmove(begin_ + it + countEl, begin_ + it, (size_ - it) * sizeof(T));
-  T temp[] = {T(std::forward<Args>(args))...};
-  std::memmove(begin_ + it, temp, countEl * sizeof(T));
+}
 
-  size_ += countEl;
+// Storage
 
-  return begin_ + it;
+template <class T, class Allocator>
+T *vector<T, Allocator>::allocate(size_type n) {
+  return n ? alloc_traits::allocate(alloc_, n) : nullptr;
 }
 
-template <class T>
+template <class T, class Allocator>
+void vector<T, Allocator>::deallocate(T *p, size_type n) {
+  if (p) {
+    alloc_traits::deallocate(alloc_, p, n);
+  }
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::destroy(T *first, T *last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy(first, last);
+  }
+}
+
+// Grows geometrically: doubling keeps push_back amortized O(1) while a single
+// reallocation does the only allocation and relocation.
+template <class T, class Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::next_capacity(
+    size_type min_capacity) {
+  if (min_capacity > max_size()) {
+    throw std::length_error("length_error");
+  }
+  size_type new_capacity = capacity_ ? capacity_ * 2 : 1;
+  if (new_capacity < min_capacity || new_capacity > max_size()) {
+    new_capacity = min_capacity;
+  }
+  return new_capacity;
+}
+
+template <class T, class Allocator>
+void vector<T, Allocator>::reallocate(size_type new_capacity) {
+  T *new_begin = allocate(new_capacity);
+  try {
+    uninitialized_relocate(begin_, begin_ + size_, new_begin);
+  } catch (...) {
+    deallocate(new_begin, new_capacity);
+    throw;
+  }
+  destroy_relocated(begin_, begin_ + size_);
+  deallocate(begin_, capacity_);
+  begin_ = new_begin;
+  capacity_ = new_capacity;
+}
+
+// The new element is built before the old ones move, so args may still refer
+// into the current storage.
+template <class T, class Allocator>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  size_t countEl = sizeof...(args);
-  if (size_ + countEl > capacity_) {
-    reserve(size_ + countEl);
+void vector<T, Allocator>::realloc_append(Args &&...args) {
+  size_type new_capacity = next_capacity(size_ + 1);
+  T *new_begin = allocate(new_capacity);
+  try {
+    ::new (static_cast<void *>(new_begin + size_))
+        T(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate(new_begin, new_capacity);
+    throw;
+  }
+  try {
+    uninitialized_relocate(begin_, begin_ + size_, new_begin);
+  } catch (...) {
+    destroy(new_begin + size_, new_begin + size_ + 1);
+    deallocate(new_begin, new_capacity);
+    throw;
   }
-  T temp[] = {T(std::forward<Args>(args))...};
-  std::memcpy(begin_ + size_, temp, countEl * sizeof(T));
-  size_ += countEl;
+  destroy_relocated(begin_, begin_ + size_);
+  deallocate(begin_, capacity_);
+  begin_ = new_begin;
+  capacity_ = new_capacity;
+  ++size_;
+}
+
+// Inserts count elements read from first before index. Within capacity the
+// tail is shifted in place; otherwise the new elements are built in fresh
+// storage first and the old ones are relocated around them once.
+template <class T, class Allocator>
+template <class InputIt>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert_range(
+    size_type index, InputIt first, size_type count) {
+  if (count == 0) {
+    return begin_ + index;
+  }
+  if (size_ + count > capacity_) {
+    size_type new_capacity = next_capacity(size_ + count);
+    T *new_begin = allocate(new_capacity);
+    try {
+      internal::insert_relocating(begin_, size_, new_begin, index, first,
+                                  count);
+    } catch (...) {
+      deallocate(new_begin, new_capacity);
+      throw;
+    }
+    destroy_relocated(begin_, begin_ + size_);
+    deallocate(begin_, capacity_);
+    begin_ = new_begin;
+    capacity_ = new_capacity;
+    size_ += count;
+  } else {
+    internal::insert_in_place(begin_, size_, index, first, count);
+  }
+  return begin_ + index;
 }
 
 }  // namespace s21
 
+#include "s21_vector_bool.h"
+
 #endif  // CPP2_S21_CONTAINERS_1_S21_VECTOR_H
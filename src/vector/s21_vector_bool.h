@@ -0,0 +1,705 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_VECTOR_BOOL_H
+#define CPP2_S21_CONTAINERS_1_S21_VECTOR_BOOL_H
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../simd/s21_simd.h"
+
+namespace s21 {
+
+// Bits packed 64 to a word. Elements are not addressable, so operator[] and
+// iterators hand out proxy references, as with std::vector<bool>. Bits past
+// size() in the last word are always zero, which lets count() and the
+// bitwise operators work on whole words. Word scans go through s21::simd.
+template <class Allocator>
+class vector<bool, Allocator> {
+  template <bool Const>
+  class bit_iterator;
+
+ public:
+  //  Vector Member type
+  using value_type = bool;
+  using allocator_type = Allocator;
+  using word_type = std::uint64_t;
+  class reference;
+  using const_reference = bool;
+  using iterator = bit_iterator<false>;
+  using const_iterator = bit_iterator<true>;
+  using size_type = size_t;
+
+  static constexpr size_type kWordBits = 64;
+
+  //  Vector Member functions
+  vector();
+  explicit vector(const Allocator &alloc);
+  vector(size_type n, const Allocator &alloc = Allocator());
+  vector(size_type n, bool value, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
+  vector(const vector &v);
+  vector(vector &&v) noexcept;
+  ~vector();
+  vector &operator=(const vector &v);
+  vector &operator=(vector &&v) noexcept;
+
+  //  Vector Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  bool operator[](size_type pos) const;
+  bool front() const;
+  bool back() const;
+  // The packed words; word_count() of them, low bit first.
+  word_type *data();
+  size_type word_count() const;
+  allocator_type get_allocator() const;
+
+  //  Vector Iterators
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  //  Vector Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  void resize(size_type count, bool value = false);
+
+  //  Modifiers
+  void clear();
+  iterator insert(const_iterator pos, bool value);
+  void erase(const_iterator pos);
+  void push_back(bool value);
+  void pop_back();
+  void swap(vector &other) noexcept;
+  void assign(size_type count, bool value);
+  void flip();
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  //  Bit operations
+  size_type count() const;
+  // Index of the first set bit, or size() if there is none.
+  size_type find_first() const;
+  // Index of the first set bit after pos, or size() if there is none.
+  size_type find_next(size_type pos) const;
+  // Element-wise with a vector of the same size; std::invalid_argument
+  // otherwise.
+  vector &operator&=(const vector &other);
+  vector &operator|=(const vector &other);
+  vector &operator^=(const vector &other);
+
+ private:
+  using word_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          word_type>;
+  using alloc_traits = std::allocator_traits<word_allocator>;
+
+  word_type *words_{};
+  size_type size_{};
+  size_type capacity_{};  // in words
+  word_allocator alloc_{};
+
+  static size_type words_for(size_type bits);
+  static word_type bit_mask(size_type pos);
+  size_type next_capacity(size_type min_bits);
+  void reallocate(size_type new_capacity);
+  void set_range(size_type first, size_type last, bool value);
+  void clear_tail();
+  void check_same_size(const vector &other) const;
+};
+
+// Proxy for one bit; converts to bool and assigns through to the word.
+template <class Allocator>
+class vector<bool, Allocator>::reference {
+ public:
+  reference(word_type *word, word_type mask) : word_(word), mask_(mask) {}
+  reference(const reference &) = default;
+
+  operator bool() const { return (*word_ & mask_) != 0; }
+  bool operator~() const { return (*word_ & mask_) == 0; }
+  reference &operator=(bool value) {
+    if (value) {
+      *word_ |= mask_;
+    } else {
+      *word_ &= ~mask_;
+    }
+    return *this;
+  }
+  reference &operator=(const reference &other) {
+    return *this = static_cast<bool>(other);
+  }
+  void flip() { *word_ ^= mask_; }
+
+ private:
+  word_type *word_;
+  word_type mask_;
+};
+
+template <class Allocator>
+template <bool Const>
+class vector<bool, Allocator>::bit_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference =
+      std::conditional_t<Const, bool, typename vector::reference>;
+
+  bit_iterator() = default;
+  bit_iterator(word_type *words, size_type pos) : words_(words), pos_(pos) {}
+  template <bool C = Const, class = std::enable_if_t<C>>
+  bit_iterator(const bit_iterator<false> &it)
+      : words_(it.words_), pos_(it.pos_) {}
+
+  reference operator*() const {
+    if constexpr (Const) {
+      return (words_[pos_ / kWordBits] & bit_mask(pos_)) != 0;
+    } else {
+      return reference(words_ + pos_ / kWordBits, bit_mask(pos_));
+    }
+  }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  bit_iterator &operator++() {
+    ++pos_;
+    return *this;
+  }
+  bit_iterator operator++(int) {
+    bit_iterator old = *this;
+    ++pos_;
+    return old;
+  }
+  bit_iterator &operator--() {
+    --pos_;
+    return *this;
+  }
+  bit_iterator operator--(int) {
+    bit_iterator old = *this;
+    --pos_;
+    return old;
+  }
+  bit_iterator &operator+=(difference_type n) {
+    pos_ += n;
+    return *this;
+  }
+  bit_iterator &operator-=(difference_type n) {
+    pos_ -= n;
+    return *this;
+  }
+  friend bit_iterator operator+(bit_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend bit_iterator operator+(difference_type n, bit_iterator it) {
+    return it += n;
+  }
+  friend bit_iterator operator-(bit_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const bit_iterator &a,
+                                   const bit_iterator &b) {
+    return static_cast<difference_type>(a.pos_) -
+           static_cast<difference_type>(b.pos_);
+  }
+
+  friend bool operator==(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ == b.pos_;
+  }
+  friend bool operator!=(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ != b.pos_;
+  }
+  friend bool operator<(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ < b.pos_;
+  }
+  friend bool operator>(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ > b.pos_;
+  }
+  friend bool operator<=(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ <= b.pos_;
+  }
+  friend bool operator>=(const bit_iterator &a, const bit_iterator &b) {
+    return a.pos_ >= b.pos_;
+  }
+
+  size_type index() const { return pos_; }
+
+ private:
+  friend class bit_iterator<true>;
+
+  word_type *words_{};
+  size_type pos_{};
+};
+
+template <class Allocator>
+vector<bool, Allocator> operator&(vector<bool, Allocator> a,
+                                  const vector<bool, Allocator> &b) {
+  return a &= b;
+}
+
+template <class Allocator>
+vector<bool, Allocator> operator|(vector<bool, Allocator> a,
+                                  const vector<bool, Allocator> &b) {
+  return a |= b;
+}
+
+template <class Allocator>
+vector<bool, Allocator> operator^(vector<bool, Allocator> a,
+                                  const vector<bool, Allocator> &b) {
+  return a ^= b;
+}
+
+// CONSTRUCTOR
+
+template <class Allocator>
+vector<bool, Allocator>::vector() = default;
+
+template <class Allocator>
+vector<bool, Allocator>::vector(const Allocator &alloc) : alloc_(alloc) {}
+
+template <class Allocator>
+vector<bool, Allocator>::vector(size_type n, const Allocator &alloc)
+    : vector(n, false, alloc) {}
+
+template <class Allocator>
+vector<bool, Allocator>::vector(size_type n, bool value,
+                                const Allocator &alloc)
+    : alloc_(alloc) {
+  resize(n, value);
+}
+
+template <class Allocator>
+vector<bool, Allocator>::vector(const std::initializer_list<value_type> &items,
+                                const Allocator &alloc)
+    : alloc_(alloc) {
+  reserve(items.size());
+  for (bool item : items) push_back(item);
+}
+
+template <class Allocator>
+vector<bool, Allocator>::vector(const vector &v)
+    : alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  size_type words = words_for(v.size_);
+  if (words != 0) {
+    words_ = alloc_traits::allocate(alloc_, words);
+    std::memcpy(words_, v.words_, words * sizeof(word_type));
+  }
+  capacity_ = words;
+  size_ = v.size_;
+}
+
+template <class Allocator>
+vector<bool, Allocator>::vector(vector &&v) noexcept
+    : words_(std::exchange(v.words_, nullptr)),
+      size_(std::exchange(v.size_, 0)),
+      capacity_(std::exchange(v.capacity_, 0)),
+      alloc_(std::move(v.alloc_)) {}
+
+template <class Allocator>
+vector<bool, Allocator>::~vector() {
+  clear();
+}
+
+template <class Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator=(const vector &v) {
+  if (this != &v) {
+    vector copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <class Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator=(
+    vector &&v) noexcept {
+  if (this != &v) {
+    clear();
+    swap(v);
+  }
+  return *this;
+}
+
+//  Vector Element access
+
+template <class Allocator>
+typename vector<bool, Allocator>::reference vector<bool, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("out_of_range");
+  }
+  return (*this)[pos];
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::reference
+vector<bool, Allocator>::operator[](size_type pos) {
+  return reference(words_ + pos / kWordBits, bit_mask(pos));
+}
+
+template <class Allocator>
+bool vector<bool, Allocator>::operator[](size_type pos) const {
+  return (words_[pos / kWordBits] & bit_mask(pos)) != 0;
+}
+
+template <class Allocator>
+bool vector<bool, Allocator>::front() const {
+  return (*this)[0];
+}
+
+template <class Allocator>
+bool vector<bool, Allocator>::back() const {
+  return (*this)[size_ - 1];
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::word_type *vector<bool, Allocator>::data() {
+  return words_;
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::word_count() const {
+  return words_for(size_);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::allocator_type
+vector<bool, Allocator>::get_allocator() const {
+  return Allocator(alloc_);
+}
+
+//  Vector Iterators
+
+template <class Allocator>
+typename vector<bool, Allocator>::iterator vector<bool, Allocator>::begin() {
+  return iterator(words_, 0);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::iterator vector<bool, Allocator>::end() {
+  return iterator(words_, size_);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::const_iterator
+vector<bool, Allocator>::begin() const {
+  return const_iterator(words_, 0);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::const_iterator
+vector<bool, Allocator>::end() const {
+  return const_iterator(words_, size_);
+}
+
+//  Vector Capacity
+
+template <class Allocator>
+bool vector<bool, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::size()
+    const {
+  return size_;
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() - (kWordBits - 1);
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("length_error");
+  }
+  if (words_for(size) > capacity_) {
+    reallocate(words_for(size));
+  }
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::capacity() const {
+  return capacity_ * kWordBits;
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::shrink_to_fit() {
+  if (words_for(size_) < capacity_) {
+    reallocate(words_for(size_));
+  }
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::resize(size_type count, bool value) {
+  if (count > size_) {
+    if (words_for(count) > capacity_) {
+      reallocate(words_for(next_capacity(count)));
+    }
+    set_range(size_, count, value);
+  }
+  size_ = count;
+  clear_tail();
+}
+
+//  Modifiers
+
+template <class Allocator>
+void vector<bool, Allocator>::clear() {
+  if (words_ != nullptr) {
+    alloc_traits::deallocate(alloc_, words_, capacity_);
+  }
+  words_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+// Bits from pos on move up by one, a word at a time with the carry from the
+// word below.
+template <class Allocator>
+typename vector<bool, Allocator>::iterator vector<bool, Allocator>::insert(
+    const_iterator pos, bool value) {
+  size_type index = pos.index();
+  if (words_for(size_ + 1) > capacity_) {
+    reallocate(words_for(next_capacity(size_ + 1)));
+  }
+  size_type first = index / kWordBits;
+  size_type last = size_ / kWordBits;
+  if (size_ % kWordBits == 0) {
+    words_[last] = 0;
+  }
+  for (size_type w = last; w > first; --w) {
+    words_[w] = (words_[w] << 1) | (words_[w - 1] >> (kWordBits - 1));
+  }
+  word_type low = bit_mask(index) - 1;
+  word_type word = words_[first];
+  words_[first] = (word & low) | ((word & ~low) << 1);
+  ++size_;
+  (*this)[index] = value;
+  return iterator(words_, index);
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::erase(const_iterator pos) {
+  size_type index = pos.index();
+  size_type first = index / kWordBits;
+  size_type last = (size_ - 1) / kWordBits;
+  word_type low = bit_mask(index) - 1;
+  word_type word = words_[first];
+  words_[first] = (word & low) | ((word >> 1) & ~low);
+  for (size_type w = first; w < last; ++w) {
+    words_[w] |= words_[w + 1] << (kWordBits - 1);
+    words_[w + 1] >>= 1;
+  }
+  --size_;
+  clear_tail();
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::push_back(bool value) {
+  if (size_ % kWordBits == 0) {
+    if (words_for(size_ + 1) > capacity_) {
+      reallocate(words_for(next_capacity(size_ + 1)));
+    }
+    words_[size_ / kWordBits] = 0;
+  }
+  if (value) {
+    words_[size_ / kWordBits] |= bit_mask(size_);
+  }
+  ++size_;
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::pop_back() {
+  --size_;
+  words_[size_ / kWordBits] &= ~bit_mask(size_);
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::swap(vector &other) noexcept {
+  std::swap(words_, other.words_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(alloc_, other.alloc_);
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::assign(size_type count, bool value) {
+  size_ = 0;
+  resize(count, value);
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::flip() {
+  size_type words = word_count();
+  for (size_type w = 0; w < words; ++w) words_[w] = ~words_[w];
+  clear_tail();
+}
+
+template <class Allocator>
+template <typename... Args>
+typename vector<bool, Allocator>::iterator
+vector<bool, Allocator>::insert_many(const_iterator pos, Args &&...args) {
+  size_type index = pos.index();
+  size_type at = index;
+  ((insert(const_iterator(words_, at++), static_cast<bool>(args))), ...);
+  return iterator(words_, index);
+}
+
+template <class Allocator>
+template <typename... Args>
+void vector<bool, Allocator>::insert_many_back(Args &&...args) {
+  reserve(size_ + sizeof...(args));
+  (push_back(static_cast<bool>(args)), ...);
+}
+
+//  Bit operations
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::count()
+    const {
+  return simd::popcount(words_, word_count());
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::find_first() const {
+  return size_ != 0 && (words_[0] & 1) ? 0 : find_next(0);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::find_next(
+    size_type pos) const {
+  size_type next = pos + 1;
+  if (next >= size_) return size_;
+  size_type w = next / kWordBits;
+  size_type words = word_count();
+  word_type word = words_[w] & ~(bit_mask(next) - 1);
+  while (word == 0) {
+    if (++w == words) return size_;
+    word = words_[w];
+  }
+  return w * kWordBits + static_cast<size_type>(__builtin_ctzll(word));
+}
+
+template <class Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator&=(
+    const vector &other) {
+  check_same_size(other);
+  simd::bit_and(words_, other.words_, word_count());
+  return *this;
+}
+
+template <class Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator|=(
+    const vector &other) {
+  check_same_size(other);
+  simd::bit_or(words_, other.words_, word_count());
+  return *this;
+}
+
+template <class Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator^=(
+    const vector &other) {
+  check_same_size(other);
+  simd::bit_xor(words_, other.words_, word_count());
+  return *this;
+}
+
+// Storage
+
+template <class Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::words_for(
+    size_type bits) {
+  return bits / kWordBits + (bits % kWordBits != 0);
+}
+
+template <class Allocator>
+typename vector<bool, Allocator>::word_type vector<bool, Allocator>::bit_mask(
+    size_type pos) {
+  return word_type{1} << (pos % kWordBits);
+}
+
+// Same doubling as the primary template, counted in bits.
+template <class Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::next_capacity(size_type min_bits) {
+  if (min_bits > max_size()) {
+    throw std::length_error("length_error");
+  }
+  size_type bits = capacity() ? capacity() * 2 : kWordBits;
+  if (bits < min_bits || bits > max_size()) {
+    bits = min_bits;
+  }
+  return bits;
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::reallocate(size_type new_capacity) {
+  word_type *new_words =
+      new_capacity ? alloc_traits::allocate(alloc_, new_capacity) : nullptr;
+  size_type words = word_count();
+  if (words != 0) {
+    std::memcpy(new_words, words_, words * sizeof(word_type));
+  }
+  if (words_ != nullptr) {
+    alloc_traits::deallocate(alloc_, words_, capacity_);
+  }
+  words_ = new_words;
+  capacity_ = new_capacity;
+}
+
+// Sets [first, last) to value; words past the old end are written whole.
+template <class Allocator>
+void vector<bool, Allocator>::set_range(size_type first, size_type last,
+                                        bool value) {
+  if (first == last) return;
+  word_type fill = value ? ~word_type{0} : 0;
+  size_type w = first / kWordBits;
+  if (first % kWordBits != 0) {
+    word_type high = ~(bit_mask(first) - 1);
+    words_[w] = (words_[w] & ~high) | (fill & high);
+    ++w;
+  }
+  size_type end = words_for(last);
+  if (w < end) {
+    simd::fill(words_ + w, end - w, fill);
+  }
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::clear_tail() {
+  if (size_ % kWordBits != 0) {
+    words_[size_ / kWordBits] &= bit_mask(size_) - 1;
+  }
+}
+
+template <class Allocator>
+void vector<bool, Allocator>::check_same_size(const vector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("vector<bool> sizes differ");
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_VECTOR_BOOL_H
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../bench/s21_bench.h"
+#include "s21_vector.h"
+
+namespace {
+
+const int kReps = 5;
+const std::size_t kMiddleOps = 100;
+
+template <class Vector>
+double push_back_ns(std::size_t n) {
+  return s21::bench::measure(kReps, [n] {
+    Vector v;
+    for (std::size_t i = 0; i < n; ++i) {
+      v.push_back(static_cast<int>(i));
+    }
+    s21::bench::do_not_optimize(v.data());
+  });
+}
+
+double s21_insert_many_back_ns(std::size_t n) {
+  return s21::bench::measure(kReps, [n] {
+    s21::vector<int> v;
+    for (std::size_t i = 0; i < n; i += 4) {
+      v.insert_many_back(1, 2, 3, 4);
+    }
+    s21::bench::do_not_optimize(v.data());
+  });
+}
+
+double std_insert_back_ns(std::size_t n) {
+  return s21::bench::measure(kReps, [n] {
+    std::vector<int> v;
+    for (std::size_t i = 0; i < n; i += 4) {
+      v.insert(v.end(), {1, 2, 3, 4});
+    }
+    s21::bench::do_not_optimize(v.data());
+  });
+}
+
+template <class Vector>
+double middle_insert_erase_ns(std::size_t n, std::size_t ops) {
+  Vector v;
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(static_cast<int>(i));
+  }
+  return s21::bench::measure(kReps, [&v, ops] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+      v.erase(v.begin() + v.size() / 2);
+    }
+    s21::bench::do_not_optimize(v.data());
+  });
+}
+
+template <class Vector>
+double middle_range_ns(std::size_t n, std::size_t ops) {
+  Vector v;
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(static_cast<int>(i));
+  }
+  std::vector<int> chunk(64, 7);
+  return s21::bench::measure(kReps, [&v, &chunk, ops] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      auto pos = v.begin() + v.size() / 2;
+      v.insert(pos, chunk.begin(), chunk.end());
+      pos = v.begin() + v.size() / 2;
+      v.erase(pos, pos + chunk.size());
+    }
+    s21::bench::do_not_optimize(v.data());
+  });
+}
+
+// Stand-in for read(2): the buffer is fully overwritten after sizing.
+void fake_read(unsigned char *buffer, std::size_t n) {
+  for (std::size_t i = 0; i < n; i += 4096) {
+    buffer[i] = static_cast<unsigned char>(i);
+  }
+}
+
+double read_buffer_ns(std::size_t n, bool default_init) {
+  return s21::bench::measure(kReps, [n, default_init] {
+    s21::vector<unsigned char> buffer;
+    if (default_init) {
+      buffer.resize_default_init(n);
+    } else {
+      buffer.resize(n);
+    }
+    fake_read(buffer.data(), n);
+    s21::bench::do_not_optimize(buffer.data());
+  });
+}
+
+// Boolean masks: packed s21::vector<bool> against one byte per flag.
+void bool_masks(std::size_t n) {
+  s21::vector<bool> a(n);
+  s21::vector<bool> b(n);
+  s21::vector<std::uint8_t> byte_a(n);
+  s21::vector<std::uint8_t> byte_b(n);
+  for (std::size_t i = 0; i < n; i += 97) {
+    a[i] = true;
+    byte_a[i] = 1;
+  }
+  for (std::size_t i = 0; i < n; i += 3) {
+    b[i] = true;
+    byte_b[i] = 1;
+  }
+  std::printf("mask of %zu flags: packed %zu KiB, bytes %zu KiB\n", n,
+              a.word_count() * sizeof(std::uint64_t) / 1024, n / 1024);
+
+  s21::bench::report("s21::vector<bool> count", n,
+                     s21::bench::measure(kReps, [&a] {
+                       s21::bench::do_not_optimize(a.count());
+                     }));
+  s21::bench::report("byte mask std::count", n,
+                     s21::bench::measure(kReps, [&byte_a] {
+                       s21::bench::do_not_optimize(std::count(
+                           byte_a.begin(), byte_a.end(), std::uint8_t(1)));
+                     }));
+  s21::bench::report("s21::vector<bool> find_next scan", n,
+                     s21::bench::measure(kReps, [&a] {
+                       std::size_t hits = 0;
+                       for (std::size_t i = a.find_first(); i < a.size();
+                            i = a.find_next(i)) {
+                         ++hits;
+                       }
+                       s21::bench::do_not_optimize(hits);
+                     }));
+  s21::bench::report("byte mask scan", n,
+                     s21::bench::measure(kReps, [&byte_a] {
+                       std::size_t hits = 0;
+                       for (std::size_t i = 0; i < byte_a.size(); ++i) {
+                         if (byte_a[i]) ++hits;
+                       }
+                       s21::bench::do_not_optimize(hits);
+                     }));
+  s21::bench::report("s21::vector<bool> &=", n,
+                     s21::bench::measure(kReps, [&a, &b] {
+                       a &= b;
+                       s21::bench::do_not_optimize(a.data());
+                     }));
+  s21::bench::report("byte mask &=", n,
+                     s21::bench::measure(kReps, [&byte_a, &byte_b] {
+                       for (std::size_t i = 0; i < byte_a.size(); ++i) {
+                         byte_a[i] &= byte_b[i];
+                       }
+                       s21::bench::do_not_optimize(byte_a.data());
+                     }));
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {1000UL, 100000UL, 10000000UL}) {
+    s21::bench::report("s21::vector push_back", n,
+                       push_back_ns<s21::vector<int>>(n));
+    s21::bench::report("std::vector push_back", n,
+                       push_back_ns<std::vector<int>>(n));
+    s21::bench::report("s21::vector insert_many_back x4", n,
+                       s21_insert_many_back_ns(n));
+    s21::bench::report("std::vector insert(end, {4})", n,
+                       std_insert_back_ns(n));
+  }
+  for (std::size_t n : {1000UL, 1000000UL}) {
+    s21::bench::report("s21::vector middle insert+erase", n, kMiddleOps,
+                       middle_insert_erase_ns<s21::vector<int>>(n, kMiddleOps));
+    s21::bench::report("std::vector middle insert+erase", n, kMiddleOps,
+                       middle_insert_erase_ns<std::vector<int>>(n, kMiddleOps));
+    s21::bench::report("s21::vector middle range insert+erase x64", n,
+                       kMiddleOps,
+                       middle_range_ns<s21::vector<int>>(n, kMiddleOps));
+    s21::bench::report("std::vector middle range insert+erase x64", n,
+                       kMiddleOps,
+                       middle_range_ns<std::vector<int>>(n, kMiddleOps));
+  }
+  const std::size_t kBufferBytes = 256UL << 20;
+  s21::bench::report("s21::vector<uchar> resize + read", kBufferBytes,
+                     read_buffer_ns(kBufferBytes, false));
+  s21::bench::report("s21::vector<uchar> default_init + read",
+                     kBufferBytes, read_buffer_ns(kBufferBytes, true));
+  bool_masks(64UL << 20);
+  return 0;
+}
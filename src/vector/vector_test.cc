@@ -1,3 +1,5 @@
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -475,6 +477,391 @@ TEST(VectorTest, InsertManyBack) {
   EXPECT_EQ(vec[4], 5);
 }
 
+TEST(push_back_suite, geometric_growth_test) {
+  s21::vector<int> s21_a;
+  std::vector<int> std_a;
+
+  for (int i = 0; i < 1000; ++i) {
+    s21_a.push_back(i);
+    std_a.push_back(i);
+    EXPECT_TRUE(s21_a.capacity() == std_a.capacity());
+  }
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+}
+
+TEST(push_back_suite, within_capacity_keeps_storage_test) {
+  s21::vector<int> s21_a;
+  s21_a.reserve(64);
+  int *storage = s21_a.data();
+
+  for (int i = 0; i < 64; ++i) {
+    s21_a.push_back(i);
+  }
+
+  EXPECT_EQ(s21_a.data(), storage);
+  EXPECT_EQ(s21_a.capacity(), static_cast<size_t>(64));
+}
+
+TEST(VectorTest, InsertManyBackGrowsPastDoubling) {
+  s21::vector<int> vec = {1};
+
+  vec.insert_many_back(2, 3, 4, 5, 6);
+
+  EXPECT_EQ(vec.size(), static_cast<size_t>(6));
+  EXPECT_GE(vec.capacity(), static_cast<size_t>(6));
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(vec[i], i + 1);
+  }
+}
+
+namespace {
+
+struct counted {
+  static int default_constructions;
+  static int copies;
+  static int moves;
+  static int live;
+
+  int value = 0;
+
+  counted() {
+    ++default_constructions;
+    ++live;
+  }
+  counted(int v) : value(v) { ++live; }
+  counted(const counted &other) : value(other.value) {
+    ++copies;
+    ++live;
+  }
+  counted(counted &&other) noexcept : value(other.value) {
+    ++moves;
+    ++live;
+  }
+  counted &operator=(const counted &other) = default;
+  counted &operator=(counted &&other) noexcept = default;
+  ~counted() { --live; }
+
+  static void reset() { default_constructions = copies = moves = live = 0; }
+};
+
+int counted::default_constructions = 0;
+int counted::copies = 0;
+int counted::moves = 0;
+int counted::live = 0;
+
+}  // namespace
+
+TEST(relocation_suite, string_test) {
+  s21::vector<std::string> s21_a;
+  std::vector<std::string> std_a;
+
+  for (int i = 0; i < 100; ++i) {
+    std::string value(40, static_cast<char>('a' + i % 26));
+    s21_a.push_back(value);
+    std_a.push_back(value);
+  }
+  s21_a.insert(s21_a.begin() + 10, "inserted");
+  std_a.insert(std_a.begin() + 10, "inserted");
+  s21_a.erase(s21_a.begin() + 3);
+  std_a.erase(std_a.begin() + 3);
+  s21_a.insert_many(s21_a.begin() + 1, std::string("x"), std::string("y"));
+  std_a.insert(std_a.begin() + 1, {"x", "y"});
+
+  s21::vector<std::string> s21_b(s21_a);
+  s21::vector<std::string> s21_c;
+  s21_c = s21_b;
+  s21_c.shrink_to_fit();
+
+  ASSERT_EQ(s21_c.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+    EXPECT_EQ(s21_c[i], std_a[i]);
+  }
+}
+
+TEST(relocation_suite, nested_vector_test) {
+  s21::vector<s21::vector<int>> outer;
+  for (int i = 0; i < 50; ++i) {
+    outer.push_back(s21::vector<int>{i, i + 1, i + 2});
+  }
+  outer.insert_many_back(s21::vector<int>{7});
+
+  EXPECT_EQ(outer.size(), static_cast<size_t>(51));
+  EXPECT_EQ(outer[49][2], 51);
+  EXPECT_EQ(outer[50][0], 7);
+}
+
+TEST(relocation_suite, move_only_test) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 20; ++i) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  v.erase(v.begin());
+
+  EXPECT_EQ(v.size(), static_cast<size_t>(19));
+  EXPECT_EQ(*v.front(), 1);
+  EXPECT_EQ(*v.back(), 19);
+}
+
+TEST(relocation_suite, reserve_moves_without_default_construction_test) {
+  counted::reset();
+  {
+    s21::vector<counted> v;
+    v.reserve(4);
+    v.push_back(counted(1));
+    v.push_back(counted(2));
+    v.push_back(counted(3));
+    EXPECT_EQ(counted::default_constructions, 0);
+    EXPECT_EQ(counted::copies, 0);
+
+    counted::moves = 0;
+    v.reserve(1000);
+    EXPECT_EQ(counted::moves, 3);
+    EXPECT_EQ(counted::default_constructions, 0);
+    EXPECT_EQ(counted::live, 3);
+  }
+  EXPECT_EQ(counted::live, 0);
+}
+
+TEST(relocation_suite, at_past_end_throws_test) {
+  s21::vector<int> v = {1, 2, 3};
+  EXPECT_THROW(v.at(3), std::out_of_range);
+}
+
+TEST(range_suite, insert_range_in_place_test) {
+  s21::vector<int> s21_a = {1, 2, 3, 4, 5, 6};
+  std::vector<int> std_a = {1, 2, 3, 4, 5, 6};
+  s21_a.reserve(32);
+  int *storage = s21_a.data();
+  std::vector<int> src = {10, 11};
+
+  s21_a.insert(s21_a.begin() + 1, src.begin(), src.end());
+  std_a.insert(std_a.begin() + 1, src.begin(), src.end());
+  std::vector<int> long_src = {20, 21, 22, 23, 24, 25, 26, 27};
+  s21_a.insert(s21_a.begin() + 6, long_src.begin(), long_src.end());
+  std_a.insert(std_a.begin() + 6, long_src.begin(), long_src.end());
+
+  EXPECT_EQ(s21_a.data(), storage);
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+}
+
+TEST(range_suite, insert_range_reallocating_test) {
+  s21::vector<std::string> s21_a = {"a", "b", "c"};
+  std::vector<std::string> std_a = {"a", "b", "c"};
+  std::vector<std::string> src = {"x", "y", "z", "w"};
+
+  s21_a.insert(s21_a.begin() + 2, src.begin(), src.end());
+  std_a.insert(std_a.begin() + 2, src.begin(), src.end());
+
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+}
+
+TEST(range_suite, erase_range_test) {
+  s21::vector<std::string> s21_a = {"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> std_a = {"a", "b", "c", "d", "e", "f"};
+
+  auto s21_itr = s21_a.erase(s21_a.begin() + 1, s21_a.begin() + 4);
+  auto std_itr = std_a.erase(std_a.begin() + 1, std_a.begin() + 4);
+
+  EXPECT_EQ(*s21_itr, *std_itr);
+  EXPECT_EQ(s21_a.capacity(), static_cast<size_t>(6));
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+  s21_a.erase(s21_a.begin(), s21_a.end());
+  EXPECT_TRUE(s21_a.empty());
+}
+
+TEST(resize_suite, grow_and_shrink_test) {
+  s21::vector<int> s21_a = {1, 2, 3};
+  std::vector<int> std_a = {1, 2, 3};
+
+  s21_a.resize(6);
+  std_a.resize(6);
+  s21_a.resize(8, 7);
+  std_a.resize(8, 7);
+  s21_a.resize(5);
+  std_a.resize(5);
+
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+}
+
+TEST(resize_suite, resize_with_own_element_test) {
+  s21::vector<std::string> v = {"keep"};
+  v.resize(10, v[0]);
+
+  EXPECT_EQ(v.size(), static_cast<size_t>(10));
+  EXPECT_EQ(v[9], "keep");
+}
+
+TEST(resize_suite, default_init_keeps_existing_and_constructs_classes_test) {
+  s21::vector<unsigned char> bytes = {1, 2};
+  bytes.resize_default_init(4096);
+  EXPECT_EQ(bytes.size(), static_cast<size_t>(4096));
+  EXPECT_EQ(bytes[1], 2);
+
+  s21::vector<std::string> strings;
+  strings.resize_default_init(3);
+  EXPECT_TRUE(strings[2].empty());
+  strings.resize_default_init(1);
+  EXPECT_EQ(strings.size(), static_cast<size_t>(1));
+}
+
+TEST(assign_suite, assign_test) {
+  s21::vector<std::string> s21_a = {"a", "b"};
+  std::vector<std::string> std_a = {"a", "b"};
+
+  s21_a.assign(5, "z");
+  std_a.assign(5, "z");
+  ASSERT_EQ(s21_a.size(), std_a.size());
+  for (size_t i = 0; i < std_a.size(); ++i) {
+    EXPECT_EQ(s21_a[i], std_a[i]);
+  }
+
+  s21_a.assign(2, s21_a[0]);
+  EXPECT_EQ(s21_a.size(), static_cast<size_t>(2));
+  EXPECT_EQ(s21_a[1], "z");
+}
+
+TEST(append_suite, append_test) {
+  s21::vector<int> v = {1, 2};
+  std::vector<int> src = {3, 4, 5, 6, 7};
+
+  v.append(src.begin(), src.end());
+  v.append(src.begin(), src.begin());
+
+  ASSERT_EQ(v.size(), static_cast<size_t>(7));
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_EQ(v[i], i + 1);
+  }
+}
+
+TEST(vector_bool_suite, push_back_and_proxy_references_test) {
+  s21::vector<bool> bits;
+  std::vector<bool> std_bits;
+  for (int i = 0; i < 200; ++i) {
+    bits.push_back(i % 3 == 0);
+    std_bits.push_back(i % 3 == 0);
+  }
+  bits[5] = true;
+  std_bits[5] = true;
+  bits.at(6) = bits[0];
+  std_bits[6] = std_bits[0];
+  bits[9].flip();
+  std_bits[9].flip();
+  ASSERT_EQ(bits.size(), std_bits.size());
+  EXPECT_EQ(bits.word_count(), static_cast<size_t>(4));
+  for (size_t i = 0; i < std_bits.size(); ++i) {
+    EXPECT_EQ(bits[i], std_bits[i]) << i;
+  }
+  EXPECT_THROW(bits.at(200), std::out_of_range);
+
+  size_t set = 0;
+  for (bool b : bits) set += b;
+  EXPECT_EQ(set, bits.count());
+}
+
+TEST(vector_bool_suite, count_and_find_test) {
+  s21::vector<bool> bits(1000);
+  EXPECT_EQ(bits.count(), static_cast<size_t>(0));
+  EXPECT_EQ(bits.find_first(), bits.size());
+  const size_t positions[] = {0, 63, 64, 65, 500, 999};
+  for (size_t p : positions) bits[p] = true;
+  EXPECT_EQ(bits.count(), static_cast<size_t>(6));
+  size_t found = bits.find_first();
+  for (size_t p : positions) {
+    EXPECT_EQ(found, p);
+    found = bits.find_next(found);
+  }
+  EXPECT_EQ(found, bits.size());
+
+  s21::vector<bool> ones(130, true);
+  EXPECT_EQ(ones.count(), static_cast<size_t>(130));
+  ones.flip();
+  EXPECT_EQ(ones.count(), static_cast<size_t>(0));
+}
+
+TEST(vector_bool_suite, bitwise_operators_test) {
+  s21::vector<bool> a(150);
+  s21::vector<bool> b(150);
+  for (size_t i = 0; i < 150; ++i) {
+    a[i] = i % 2 == 0;
+    b[i] = i % 3 == 0;
+  }
+  s21::vector<bool> both = a & b;
+  s21::vector<bool> either = a | b;
+  s21::vector<bool> one = a ^ b;
+  for (size_t i = 0; i < 150; ++i) {
+    EXPECT_EQ(both[i], i % 6 == 0);
+    EXPECT_EQ(either[i], i % 2 == 0 || i % 3 == 0);
+    EXPECT_EQ(one[i], (i % 2 == 0) != (i % 3 == 0));
+  }
+  s21::vector<bool> shorter(149);
+  EXPECT_THROW(a &= shorter, std::invalid_argument);
+}
+
+TEST(vector_bool_suite, insert_erase_across_words_test) {
+  s21::vector<bool> bits;
+  std::vector<bool> std_bits;
+  for (int i = 0; i < 130; ++i) {
+    bits.push_back(i % 5 == 1);
+    std_bits.push_back(i % 5 == 1);
+  }
+  for (size_t pos : {0UL, 63UL, 64UL, 100UL, 131UL, 128UL}) {
+    bits.insert(bits.begin() + pos, true);
+    std_bits.insert(std_bits.begin() + pos, true);
+  }
+  bits.insert_many(bits.begin() + 2, false, true, true);
+  std_bits.insert(std_bits.begin() + 2, {false, true, true});
+  for (size_t pos : {0UL, 62UL, 64UL, 120UL}) {
+    bits.erase(bits.begin() + pos);
+    std_bits.erase(std_bits.begin() + pos);
+  }
+  bits.pop_back();
+  std_bits.pop_back();
+  ASSERT_EQ(bits.size(), std_bits.size());
+  for (size_t i = 0; i < std_bits.size(); ++i) {
+    EXPECT_EQ(bits[i], std_bits[i]) << i;
+  }
+  size_t std_count = 0;
+  for (bool b : std_bits) std_count += b;
+  EXPECT_EQ(bits.count(), std_count);
+}
+
+TEST(vector_bool_suite, resize_assign_and_copy_test) {
+  s21::vector<bool> bits = {true, false, true};
+  bits.resize(70, true);
+  EXPECT_EQ(bits.count(), static_cast<size_t>(69));
+  bits.resize(2);
+  EXPECT_EQ(bits.count(), static_cast<size_t>(1));
+  bits.resize(66);
+  EXPECT_EQ(bits.count(), static_cast<size_t>(1));
+  bits.insert_many_back(true, true);
+  EXPECT_TRUE(bits.back());
+
+  s21::vector<bool> copy(bits);
+  copy.assign(10, true);
+  EXPECT_EQ(copy.count(), static_cast<size_t>(10));
+  EXPECT_EQ(bits.count(), static_cast<size_t>(3));
+  s21::vector<bool> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), static_cast<size_t>(10));
+  moved.clear();
+  EXPECT_EQ(moved.capacity(), static_cast<size_t>(0));
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
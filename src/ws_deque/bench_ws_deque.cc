@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "../bench/s21_bench.h"
+#include "../parallel/s21_thread_pool.h"
+#include "../queue/s21_queue.h"
+#include "../vector/s21_vector.h"
+
+namespace {
+
+const int kReps = 3;
+
+// The scheduler the work-stealing pool replaces: every task from every
+// thread goes through one mutex-guarded s21::queue.
+class shared_queue_pool {
+ public:
+  using task = std::function<void()>;
+
+  explicit shared_queue_pool(std::size_t threads) {
+    for (std::size_t i = 0; i < threads; ++i) {
+      threads_.push_back(std::thread([this] { worker_loop(); }));
+    }
+  }
+  ~shared_queue_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &t : threads_) t.join();
+  }
+
+  void submit(task t) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push(t);
+    }
+    wake_.notify_one();
+  }
+  bool run_pending() {
+    task t;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (tasks_.empty()) return false;
+      t = tasks_.front();
+      tasks_.pop_front();
+    }
+    t();
+    return true;
+  }
+
+ private:
+  void worker_loop() {
+    for (;;) {
+      task t;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) return;
+        t = tasks_.front();
+        tasks_.pop_front();
+      }
+      t();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  s21::queue<task> tasks_;
+  s21::vector<std::thread> threads_;
+  bool stop_ = false;
+};
+
+// Minimal fork-join group over either pool: wait() helps run tasks.
+template <class Pool>
+class fork_join {
+ public:
+  explicit fork_join(Pool &pool) : pool_(pool) {}
+
+  template <class Fn>
+  void run(Fn fn) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, fn] {
+      fn();
+      pending_.fetch_sub(1, std::memory_order_release);
+    });
+  }
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      if (!pool_.run_pending()) std::this_thread::yield();
+    }
+  }
+
+ private:
+  Pool &pool_;
+  std::atomic<int> pending_{0};
+};
+
+const std::size_t kSortGrain = 2048;
+
+// Quicksort that forks the left half and recurses into the right.
+template <class Pool>
+void quicksort(Pool &pool, int *first, int *last) {
+  if (static_cast<std::size_t>(last - first) <= kSortGrain) {
+    std::sort(first, last);
+    return;
+  }
+  int pivot = *(first + (last - first) / 2);
+  int *mid1 = std::partition(first, last, [pivot](int x) { return x < pivot; });
+  int *mid2 = std::partition(mid1, last, [pivot](int x) { return x == pivot; });
+  fork_join<Pool> group(pool);
+  group.run([&pool, first, mid1] { quicksort(pool, first, mid1); });
+  quicksort(pool, mid2, last);
+  group.wait();
+}
+
+// Binary fork-join tree with almost no work per node: pure scheduling cost.
+// Kept shallow for the shared queue's sake: a thread helping in wait() takes
+// the oldest task there, the root of a large subtree, so the nesting grows
+// with the number of tasks instead of with the depth, as it does when each
+// worker pops its own newest task.
+template <class Pool>
+std::uint64_t tree(Pool &pool, int depth) {
+  if (depth == 0) return 1;
+  std::uint64_t left = 0;
+  fork_join<Pool> group(pool);
+  group.run([&pool, &left, depth] { left = tree(pool, depth - 1); });
+  std::uint64_t right = tree(pool, depth - 1);
+  group.wait();
+  return left + right;
+}
+
+template <class Pool>
+void run(const char *name, std::size_t threads, s21::vector<int> &input) {
+  Pool pool(threads);
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s tree(14) threads=%zu", name, threads);
+  double ns = s21::bench::measure(kReps, [&pool] {
+    s21::bench::do_not_optimize(tree(pool, 14));
+  });
+  s21::bench::report(label, std::size_t(1) << 14, ns);
+
+  ns = 0;
+  for (int r = 0; r < kReps; ++r) {
+    s21::vector<int> v = input;
+    ns += s21::bench::measure(
+        1, [&] { quicksort(pool, v.data(), v.data() + v.size()); });
+  }
+  std::snprintf(label, sizeof(label), "%s quicksort threads=%zu", name,
+                threads);
+  s21::bench::report(label, input.size(), ns / kReps);
+}
+
+}  // namespace
+
+// Usage: ./bench [threads]
+int main(int argc, char **argv) {
+  std::size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                                 : s21::thread_pool::default_concurrency();
+  std::mt19937 gen(42);
+  s21::vector<int> input(std::size_t(1) << 22);
+  for (int &x : input) x = static_cast<int>(gen());
+  run<shared_queue_pool>("shared s21::queue", threads, input);
+  run<s21::thread_pool>("s21::thread_pool", threads, input);
+  return 0;
+}
@@ -0,0 +1,186 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_WS_DEQUE_H
+#define CPP2_S21_CONTAINERS_1_S21_WS_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Chase-Lev work-stealing deque, in the C11 formulation of Le, Pop, Cohen
+// and Zappa Nardelli. One owner thread pushes and pops at the bottom with
+// plain loads and stores; any number of thieves take from the top with one
+// CAS. The owner and thieves only race over the last element. The ring
+// doubles when full; retired rings are kept until the deque dies because a
+// slow thief may still be reading one.
+//
+// Thieves copy an element before their CAS decides whether they own it, so
+// T must be trivially copyable; queue pointers to anything larger.
+template <class T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ws_deque elements must be trivially copyable");
+
+ public:
+  //  Member type
+  using value_type = T;
+  using size_type = size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+  //  Member functions
+  // capacity is rounded up to a power of two, at least 2.
+  explicit ws_deque(size_type capacity = 64);
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+  ~ws_deque() = default;
+
+  //  Capacity
+  // A snapshot, exact only on the owner while no thief is running.
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  //  Owner side
+  void push(T value);
+  // Takes the most recently pushed element.
+  bool pop(T &value);
+
+  //  Thief side, any thread
+  // Takes the oldest element. Returns false if the deque was empty or
+  // another thread won the race for that element.
+  bool steal(T &value);
+
+ private:
+  struct ring {
+    explicit ring(size_type capacity)
+        : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+    T get(std::int64_t i) const {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, T value) {
+      slots[i & mask].store(value, std::memory_order_relaxed);
+    }
+
+    size_type mask;
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+  ring *grow(ring *old, std::int64_t bottom, std::int64_t top);
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<ring *> ring_;
+  // Owner only: every ring ever used, the live one last.
+  s21::vector<std::unique_ptr<ring>> rings_;
+};
+
+// CONSTRUCTOR
+
+template <class T>
+ws_deque<T>::ws_deque(size_type capacity) {
+  size_type n = 2;
+  while (n < capacity) n *= 2;
+  rings_.push_back(std::make_unique<ring>(n));
+  ring_.store(rings_.back().get(), std::memory_order_relaxed);
+}
+
+// Capacity
+
+template <class T>
+bool ws_deque<T>::empty() const {
+  return size() == 0;
+}
+
+template <class T>
+typename ws_deque<T>::size_type ws_deque<T>::size() const {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <class T>
+typename ws_deque<T>::size_type ws_deque<T>::capacity() const {
+  return ring_.load(std::memory_order_relaxed)->mask + 1;
+}
+
+// Owner side
+
+template <class T>
+void ws_deque<T>::push(T value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  ring *r = ring_.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<std::int64_t>(r->mask)) {
+    r = grow(r, bottom, top);
+  }
+  r->put(bottom, value);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+// Reserves the bottom element first, then looks at top. Only when that was
+// the last element does the owner have to win it with the same CAS the
+// thieves use.
+template <class T>
+bool ws_deque<T>::pop(T &value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  ring *r = ring_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  value = r->get(bottom);
+  if (top == bottom) {
+    bool won = top_.compare_exchange_strong(top, top + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+// Thief side
+
+template <class T>
+bool ws_deque<T>::steal(T &value) {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return false;
+  ring *r = ring_.load(std::memory_order_acquire);
+  T candidate = r->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  value = candidate;
+  return true;
+}
+
+// Storage
+
+// Copies the live range [top, bottom) into a ring twice the size. The old
+// ring stays readable for thieves that loaded it before the swap.
+template <class T>
+typename ws_deque<T>::ring *ws_deque<T>::grow(ring *old, std::int64_t bottom,
+                                              std::int64_t top) {
+  rings_.push_back(std::make_unique<ring>(2 * (old->mask + 1)));
+  ring *r = rings_.back().get();
+  for (std::int64_t i = top; i < bottom; ++i) r->put(i, old->get(i));
+  ring_.store(r, std::memory_order_release);
+  return r;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_WS_DEQUE_H
@@ -0,0 +1,132 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "s21_ws_deque.h"
+
+TEST(ws_deque_suite, owner_is_lifo_thief_is_fifo) {
+  s21::ws_deque<int> d;
+  EXPECT_TRUE(d.empty());
+  for (int i = 0; i < 5; ++i) d.push(i);
+  EXPECT_EQ(d.size(), static_cast<size_t>(5));
+  int value = -1;
+  ASSERT_TRUE(d.pop(value));
+  EXPECT_EQ(value, 4);
+  ASSERT_TRUE(d.steal(value));
+  EXPECT_EQ(value, 0);
+  ASSERT_TRUE(d.steal(value));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(d.pop(value));
+  EXPECT_EQ(value, 3);
+  ASSERT_TRUE(d.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(d.pop(value));
+  EXPECT_FALSE(d.steal(value));
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(ws_deque_suite, capacity_rounds_up) {
+  EXPECT_EQ(s21::ws_deque<int>(0).capacity(), static_cast<size_t>(2));
+  EXPECT_EQ(s21::ws_deque<int>(33).capacity(), static_cast<size_t>(64));
+}
+
+TEST(ws_deque_suite, grows_after_wrapping) {
+  s21::ws_deque<int> d(4);
+  int value = 0;
+  for (int i = 0; i < 3; ++i) d.push(i);
+  d.steal(value);
+  d.steal(value);
+  for (int i = 3; i < 40; ++i) d.push(i);
+  EXPECT_EQ(d.capacity(), static_cast<size_t>(64));
+  EXPECT_EQ(d.size(), static_cast<size_t>(38));
+  for (int i = 2; i < 20; ++i) {
+    ASSERT_TRUE(d.steal(value));
+    EXPECT_EQ(value, i);
+  }
+  for (int i = 39; i >= 20; --i) {
+    ASSERT_TRUE(d.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(ws_deque_suite, pointers_as_elements) {
+  int a = 1, b = 2;
+  s21::ws_deque<int *> d;
+  d.push(&a);
+  d.push(&b);
+  int *p = nullptr;
+  ASSERT_TRUE(d.steal(p));
+  EXPECT_EQ(p, &a);
+  ASSERT_TRUE(d.pop(p));
+  EXPECT_EQ(p, &b);
+}
+
+TEST(ws_deque_suite, last_element_goes_to_exactly_one_side) {
+  s21::ws_deque<int> d;
+  std::atomic<int> round{-1};
+  std::atomic<int> stolen{0};
+  const int rounds = 2000;
+  std::thread thief([&] {
+    int value;
+    for (int r = 0; r < rounds; ++r) {
+      while (round.load(std::memory_order_acquire) < r) {
+        std::this_thread::yield();
+      }
+      if (d.steal(value)) stolen.fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+  int popped = 0;
+  for (int r = 0; r < rounds; ++r) {
+    d.push(r);
+    round.store(r, std::memory_order_release);
+    int value;
+    if (d.pop(value)) ++popped;
+    // Wait for the thief to finish with this round before the next push.
+    while (d.size() != 0) std::this_thread::yield();
+  }
+  thief.join();
+  int value;
+  while (d.steal(value)) stolen.fetch_add(1, std::memory_order_relaxed);
+  EXPECT_EQ(popped + stolen.load(), rounds);
+}
+
+TEST(ws_deque_suite, owner_and_thieves_take_each_element_once) {
+  const int n = 100000, thieves = 3;
+  s21::ws_deque<int> d(8);
+  std::vector<std::atomic<int>> taken(n);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t) {
+    threads.emplace_back([&] {
+      int value;
+      while (!done.load(std::memory_order_acquire) || !d.empty()) {
+        if (d.steal(value)) {
+          taken[value].fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < n; ++i) {
+    d.push(i);
+    if (i % 3 == 0 && d.pop(value)) {
+      taken[value].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  while (d.pop(value)) taken[value].fetch_add(1, std::memory_order_relaxed);
+  done.store(true, std::memory_order_release);
+  for (std::thread &t : threads) t.join();
+  int wrong = 0;
+  for (const std::atomic<int> &count : taken) wrong += count.load() != 1;
+  EXPECT_EQ(wrong, 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}